@@ -14,10 +14,28 @@ Arda OS;
 static inline bool isDeleted(const Task& task);
 static inline void markDeleted(Task& task);
 static inline void clearDeleted(Task& task);
+#ifndef ARDA_NO_NAMES
+static inline const char* taskName(const Task& task);
+#endif
+static inline TaskCallback taskSetup(const Task& task);
+static inline TaskCallback taskLoop(const Task& task);
+static inline TaskCallback taskTeardown(const Task& task);
+
+// Reading a task name: with ARDA_FLASH_NAMES on AVR it lives in PROGMEM
+#if defined(ARDA_FLASH_NAMES) && defined(__AVR__)
+#define ARDA_NAME_BYTE(p) ((char)pgm_read_byte(p))
+#define ARDA_NAME_LEN(p)  strlen_P(p)
+#else
+#define ARDA_NAME_BYTE(p) (*(p))
+#define ARDA_NAME_LEN(p)  strlen(p)
+#endif
+#ifdef ARDA_FLASH_NAMES
+#define ARDA_NAME_IN_FLASH true   // Stored task names are read with ARDA_NAME_BYTE
+#else
+#define ARDA_NAME_IN_FLASH false
+#endif
 static inline TaskState extractState(const Task& task);
 static inline void updateState(Task& task, TaskState state);
-static inline bool checkRanThisCycle(const Task& task);
-static inline void updateRanThisCycle(Task& task, bool val);
 #ifdef ARDA_YIELD
 static inline bool checkInYield(const Task& task);
 static inline void updateInYield(Task& task, bool val);
@@ -26,6 +44,13 @@ static inline void updateInYield(Task& task, bool val);
 static inline uint8_t extractPriority(const Task& task);
 static inline void updatePriority(Task& task, uint8_t priority);
 #endif
+static inline uint8_t readyLevel(const Task& task);
+static inline void setMaskBit(uint8_t* mask, int8_t id);
+static inline int8_t takeReadyTask(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], const uint8_t* owed);
+
+// Compile-time time sources (see ARDA_CLOCK_SOURCE / ARDA_MICROS_SOURCE in Arda.h)
+static uint32_t ardaDefaultClock() { return (uint32_t)ARDA_CLOCK_SOURCE(); }
+static uint32_t ardaMicrosClock() { return (uint32_t)ARDA_MICROS_SOURCE(); }
 
 #ifdef ARDA_SHELL_ACTIVE
 void ardaShellLoop_();  // Forward decl for constructor (non-static, declared friend in Arda class)
@@ -139,7 +164,10 @@ ISR(TIMER2_OVF_vect) {
 // Constructor
 // =============================================================================
 
-Arda::Arda() {
+Arda::Arda(ClockSource clock) {
+#ifdef ARDA_NAME_INDEX
+    nameIndexClear_();
+#endif
 #ifdef ARDA_SHELL_ACTIVE
     // Only initialize shell on the global OS instance
     // (shell callback is hard-wired to OS, so local instances shouldn't have it)
@@ -172,19 +200,38 @@ Arda::Arda() {
     activeCount = 0;
     for (int8_t i = 0; i < ARDA_MAX_TASKS; i++) {
 #endif
+#ifdef ARDA_TABLE_TASKS
+        tasks[i].def = nullptr;
+#else
         tasks[i].setup = nullptr;
         tasks[i].loop = nullptr;
         tasks[i].teardown = nullptr;
+#endif
+#ifdef ARDA_TASK_CONTEXT
+        tasks[i].context = nullptr;
+#endif
 #ifdef ARDA_TASK_RECOVERY
         tasks[i].recover = nullptr;
 #endif
         tasks[i].interval = 0;
         tasks[i].lastRun = 0;
         tasks[i].runCount = 0;
+        tasks[i].notify = 0;
+        tasks[i].mode = 0;
+#ifdef ARDA_PROTOTHREADS
+        tasks[i].ptInterval = 0;
+        tasks[i].resume = 0;
+#endif
 #ifdef ARDA_TASK_RECOVERY
         tasks[i].timeout = 0;
 #endif
-#ifdef ARDA_NO_NAMES
+#ifdef ARDA_EDF
+        tasks[i].deadline = 0;
+#endif
+#ifdef ARDA_TASK_DELETED_STATE
+  #if defined(ARDA_FLASH_NAMES) && !defined(ARDA_TABLE_TASKS)
+        tasks[i].name = nullptr;
+  #endif
   #ifndef ARDA_NO_PRIORITY
         tasks[i].flags = (ARDA_DEFAULT_PRIORITY << ARDA_TASK_PRIORITY_SHIFT) | ARDA_TASK_DELETED_STATE;
   #else
@@ -206,6 +253,8 @@ Arda::Arda() {
     freeListHead = -1;
     callbackDepth = 0;
     flags_ = 0;
+    readyGen_ = 0;
+    schedClear_();
     error_ = ArdaError::Ok;
 #ifdef ARDA_TASK_RECOVERY
     timeoutCallback = nullptr;
@@ -215,6 +264,41 @@ Arda::Arda() {
 #endif
     startFailureCallback = nullptr;
     traceCallback = nullptr;
+    idleCallback = nullptr;
+    deferHandler = nullptr;
+    deferHead_ = 0;
+    deferTail_ = 0;
+    deferDropped_ = 0;
+    clock_ = clock ? clock : ardaDefaultClock;
+#ifdef ARDA_EDF
+    policy_ = SchedulerPolicy::Priority;
+#endif
+#ifndef ARDA_NO_PRIORITY
+    agingStepMs_ = 0;
+#endif
+    cycleBudgetUs_ = 0;
+#ifdef ARDA_CHILD_SCHEDULERS
+    budgetStartUs_ = 0;
+    parent_ = nullptr;
+#endif
+#if ARDA_MAX_TIMERS > 0
+    for (int8_t k = 0; k < ARDA_MAX_TIMERS; k++) {
+        timers_[k].callback = nullptr;
+        timers_[k].gen = 1;
+    }
+    timerHead_ = -1;
+#endif
+#if ARDA_MAX_GROUPS > 0
+    groupClear_();
+#endif
+#if ARDA_MAX_DEPENDENCIES > 0
+    depClear_();
+#endif
+#ifdef ARDA_COROUTINES
+    coroCurrent_ = -1;
+    coroDepth_ = 0;
+    coroClear_();
+#endif
 }
 
 #ifdef ARDA_SHELL_ACTIVE
@@ -222,22 +306,45 @@ Arda::Arda() {
 void Arda::initShell_() {
     taskCount = 1;
     activeCount = 1;
-#ifndef ARDA_NO_NAMES
+#ifdef ARDA_TABLE_TASKS
+    static const ArdaTaskDef shellDef ARDA_PROGMEM = ARDA_TASK_DEF("sh", nullptr, ardaShellLoop_, 0);
+    tasks[0].def = &shellDef;
+#elif defined(ARDA_FLASH_NAMES)
+    static const char shellName[] ARDA_PROGMEM = "sh";
+    tasks[0].name = shellName;
+#elif !defined(ARDA_NO_NAMES)
     strncpy(tasks[0].name, "sh", ARDA_MAX_NAME_LEN - 1);
     tasks[0].name[ARDA_MAX_NAME_LEN - 1] = '\0';
 #endif
+#ifdef ARDA_NAME_INDEX
+    nameIndexInsert_(0);
+#endif
+#ifndef ARDA_TABLE_TASKS
     tasks[0].setup = nullptr;
     tasks[0].loop = ardaShellLoop_;
     tasks[0].teardown = nullptr;
+#endif
+#ifdef ARDA_TASK_CONTEXT
+    tasks[0].context = nullptr;
+#endif
 #ifdef ARDA_TASK_RECOVERY
     tasks[0].recover = nullptr;
 #endif
     tasks[0].interval = 0;
     tasks[0].lastRun = 0;
     tasks[0].runCount = 0;
+    tasks[0].notify = 0;
+    tasks[0].mode = 0;
+#ifdef ARDA_PROTOTHREADS
+    tasks[0].ptInterval = 0;
+    tasks[0].resume = 0;
+#endif
 #ifdef ARDA_TASK_RECOVERY
     tasks[0].timeout = 0;
 #endif
+#ifdef ARDA_EDF
+    tasks[0].deadline = 0;
+#endif
 #ifndef ARDA_NO_PRIORITY
     tasks[0].flags = (ARDA_DEFAULT_PRIORITY << ARDA_TASK_PRIORITY_SHIFT);
 #else
@@ -245,7 +352,7 @@ void Arda::initShell_() {
 #endif
 #ifndef ARDA_SHELL_MANUAL_START
     // Mark shell for auto-start in begin() (unless manual start mode)
-    tasks[0].flags |= ARDA_TASK_RAN_BIT;
+    tasks[0].flags |= ARDA_TASK_AUTOSTART_BIT;
 #endif
     shellDeleted_ = false;
 }
@@ -263,7 +370,7 @@ int8_t Arda::begin() {
     }
 
     flags_ |= FLAG_BEGUN;
-    startTime = millis();
+    startTime = clock_();
 
 #ifdef ARDA_WATCHDOG
     wdt_enable(WDTO_8S);
@@ -302,17 +409,16 @@ int8_t Arda::begin() {
         // Skip tasks that are already Running or Paused (user started them before begin())
         TaskState state = extractState(tasks[i]);
         if (state == TaskState::Running || state == TaskState::Paused) {
-            tasks[i].flags &= ~ARDA_TASK_RAN_BIT;  // Clear stale autoStart bit
+            tasks[i].flags &= ~ARDA_TASK_AUTOSTART_BIT;  // Clear stale autoStart bit
             started++;  // Count as already started
             continue;
         }
 
         // Skip tasks created with autoStart=false (bit 2 not set)
-        // Bit 2 is reused: before begin() = shouldAutoStart, after = ranThisCycle
-        if (!(tasks[i].flags & ARDA_TASK_RAN_BIT)) {
+        if (!(tasks[i].flags & ARDA_TASK_AUTOSTART_BIT)) {
             continue;
         }
-        tasks[i].flags &= ~ARDA_TASK_RAN_BIT;  // Clear the bit (will be ranThisCycle now)
+        tasks[i].flags &= ~ARDA_TASK_AUTOSTART_BIT;  // Consumed - bit 2 is unused after begin()
 
         StartResult result = startTask(i);
         if (result == StartResult::Success) {
@@ -351,6 +457,10 @@ bool Arda::run() {
         error_ = ArdaError::InCallback;  // Already in a run cycle (reentrancy)
         return false;
     }
+    drainDeferred_();  // Hand ISR work to tasks before choosing what runs
+#if ARDA_MAX_TIMERS > 0
+    runTimers_();
+#endif
     runInternal(-1);  // Run all tasks
     // Preserve any error set during task execution (e.g., by task code calling
     // scheduler APIs). Only set Ok if no error was set during this cycle.
@@ -358,6 +468,227 @@ bool Arda::run() {
     return true;
 }
 
+bool Arda::runOrSleep() {
+    if (!run()) return false;
+    if (idleCallback == nullptr) return true;
+
+    uint32_t idleMs = msUntilNextDue();
+    if (idleMs > 0 && callbackDepth < ARDA_MAX_CALLBACK_DEPTH) {
+        callbackDepth++;
+        idleCallback(idleMs);
+        callbackDepth--;
+    }
+    return true;
+}
+
+uint32_t Arda::msUntilNextDue() const {
+    if (!(flags_ & FLAG_BEGUN)) return UINT32_MAX;
+    if (deferHead_ != deferTail_) return 0;  // ISR work waiting for the next run()
+    uint32_t wait = UINT32_MAX;
+#if ARDA_MAX_TIMERS > 0
+    if (timerHead_ >= 0) {  // The list head is the earliest timer
+        int32_t left = (int32_t)(timers_[timerHead_].due - clock_());
+        if (left <= 0) return 0;
+        wait = (uint32_t)left;
+    }
+#endif
+    for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+        if (carryMask_[b]) return 0;  // Left over from a budget-limited run()
+    }
+
+    // Any interval-0 task is ready on the next cycle
+    for (uint8_t p = 0; p < ARDA_READY_LEVELS; p++) {
+        for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+            if (everyCycleMask_[p][b]) return 0;
+        }
+    }
+
+    // Each heap's top holds its earliest deadline
+    if (dueCount_[HEAP_MS] > 0) {
+        int8_t id = dueHeap_[HEAP_MS][0];
+        uint32_t elapsed = clock_() - tasks[id].lastRun;
+        if (elapsed >= tasks[id].interval) return 0;
+        if (tasks[id].interval - elapsed < wait) wait = tasks[id].interval - elapsed;
+    }
+    if (dueCount_[HEAP_US] > 0) {
+        int8_t id = dueHeap_[HEAP_US][0];
+        uint32_t elapsed = ardaMicrosClock() - tasks[id].lastRun;
+        if (elapsed >= tasks[id].interval) return 0;
+        uint32_t waitUs = (tasks[id].interval - elapsed) / 1000;  // Round down: never oversleep
+        if (waitUs < wait) wait = waitUs;
+    }
+    return wait;
+}
+
+bool Arda::deferFromISR(int8_t taskId, uint16_t payload) {
+    uint8_t head = deferHead_;
+    if ((uint8_t)(head - deferTail_) >= ARDA_DEFER_QUEUE_SIZE) {
+        if (deferDropped_ < 255) deferDropped_++;
+        return false;
+    }
+    uint8_t slot = head & (ARDA_DEFER_QUEUE_SIZE - 1);
+    deferTask_[slot] = taskId;
+    deferPayload_[slot] = payload;
+    deferHead_ = (uint8_t)(head + 1);  // Publish only after the slot is written
+    return true;
+}
+
+uint8_t Arda::getDeferDropCount() const {
+    return deferDropped_;
+}
+
+#if ARDA_MAX_TIMERS > 0
+// -----------------------------------------------------------------------------
+// Software timers: a fixed pool linked into one list sorted by due time, so run()
+// only looks at the head. Handles pack (generation << 8 | slot); the generation
+// changes whenever a slot is freed, so stale handles are rejected.
+// -----------------------------------------------------------------------------
+
+TimerHandle Arda::setTimeout(TimerCallback callback, uint32_t ms) {
+    return addTimer_(callback, ms, false);
+}
+
+TimerHandle Arda::setInterval(TimerCallback callback, uint32_t ms) {
+    if (ms == 0) {
+        error_ = ArdaError::InvalidValue;
+        return 0;
+    }
+    return addTimer_(callback, ms, true);
+}
+
+TimerHandle Arda::addTimer_(TimerCallback callback, uint32_t ms, bool periodic) {
+    if (callback == nullptr || ms > ARDA_MAX_INTERVAL) {
+        error_ = ArdaError::InvalidValue;
+        return 0;
+    }
+    int8_t slot = -1;
+    for (int8_t k = 0; k < ARDA_MAX_TIMERS; k++) {
+        if (timers_[k].callback == nullptr) {
+            slot = k;
+            break;
+        }
+    }
+    if (slot < 0) {
+        error_ = ArdaError::NoTimers;
+        return 0;
+    }
+    Timer_& t = timers_[slot];
+    t.callback = callback;
+    t.due = clock_() + ms;
+    t.period = periodic ? ms : 0;
+    timerInsert_(slot);
+    error_ = ArdaError::Ok;
+    return (TimerHandle)(((uint16_t)t.gen << 8) | (uint8_t)slot);
+}
+
+bool Arda::cancelTimer(TimerHandle handle) {
+    int8_t slot = timerSlot_(handle);
+    if (slot < 0) {
+        error_ = ArdaError::InvalidId;
+        return false;
+    }
+    timerUnlink_(slot);
+    timerFree_(slot);
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+bool Arda::isTimerActive(TimerHandle handle) const {
+    return timerSlot_(handle) >= 0;
+}
+
+int8_t Arda::timerSlot_(TimerHandle handle) const {
+    uint8_t slot = handle & 0xFF;
+    if (slot >= ARDA_MAX_TIMERS) return -1;
+    const Timer_& t = timers_[slot];
+    if (t.callback == nullptr || t.gen != (uint8_t)(handle >> 8)) return -1;
+    return (int8_t)slot;
+}
+
+void Arda::timerInsert_(int8_t slot) {
+    uint32_t due = timers_[slot].due;
+    int8_t* link = &timerHead_;
+    while (*link >= 0 && (int32_t)(timers_[*link].due - due) <= 0) {
+        link = &timers_[*link].next;  // Equal due times keep insertion order
+    }
+    timers_[slot].next = *link;
+    *link = slot;
+}
+
+void Arda::timerUnlink_(int8_t slot) {
+    int8_t* link = &timerHead_;
+    while (*link >= 0) {
+        if (*link == slot) {
+            *link = timers_[slot].next;
+            return;
+        }
+        link = &timers_[*link].next;
+    }
+}
+
+void Arda::timerFree_(int8_t slot) {
+    timers_[slot].callback = nullptr;
+    uint8_t gen = (uint8_t)(timers_[slot].gen + 1);
+    timers_[slot].gen = gen ? gen : 1;  // Never 0, so a handle is never 0
+}
+
+void Arda::timerClear_() {
+    for (int8_t k = 0; k < ARDA_MAX_TIMERS; k++) {
+        if (timers_[k].callback) timerFree_(k);
+    }
+    timerHead_ = -1;
+}
+
+// Fire due timers earliest first. Each is unlinked (one-shot: freed, periodic:
+// re-armed) before its callback, so the callback may cancel or create timers.
+// At most ARDA_MAX_TIMERS callbacks per run(), so timers that keep re-arming
+// with 0 delay cannot starve the tasks.
+void Arda::runTimers_() {
+    uint32_t now = clock_();
+    for (uint8_t fired = 0; fired < ARDA_MAX_TIMERS && timerHead_ >= 0; fired++) {
+        int8_t slot = timerHead_;
+        Timer_& t = timers_[slot];
+        if ((int32_t)(now - t.due) < 0) break;  // Head not due - nothing else is
+        if (callbackDepth >= ARDA_MAX_CALLBACK_DEPTH) break;  // Keep for next run()
+        TimerCallback callback = t.callback;
+        timerHead_ = t.next;
+        if (t.period) {
+            t.due += t.period;
+            if ((int32_t)(now - t.due) >= 0) t.due = now + t.period;  // Skip missed periods
+            timerInsert_(slot);
+        } else {
+            timerFree_(slot);
+        }
+        callbackDepth++;
+        callback();
+        callbackDepth--;
+    }
+}
+#endif
+
+void Arda::drainDeferred_() {
+    // Bound the drain to what is queued now so an interrupt storm can't starve tasks
+    uint8_t head = deferHead_;
+    uint8_t tail = deferTail_;
+    while (tail != head) {
+        uint8_t slot = tail & (ARDA_DEFER_QUEUE_SIZE - 1);
+        int8_t taskId = deferTask_[slot];
+        uint16_t payload = deferPayload_[slot];
+        if (deferHandler) {
+            if (callbackDepth >= ARDA_MAX_CALLBACK_DEPTH) break;  // Keep the rest for next run()
+            deferTail_ = ++tail;  // Free the slot before the handler can re-queue
+            callbackDepth++;
+            deferHandler(taskId, payload);
+            callbackDepth--;
+        } else {
+            deferTail_ = ++tail;
+            ArdaError savedError = error_;
+            notifyTask(taskId, ARDA_NOTIFY_DEFER);  // Stale IDs are dropped silently
+            error_ = savedError;
+        }
+    }
+}
+
 void Arda::runInternal(int8_t skipTask) {
     // Reentrancy guard - prevent recursive calls
     if (flags_ & FLAG_IN_RUN) return;
@@ -370,400 +701,492 @@ void Arda::runInternal(int8_t skipTask) {
     wdt_reset();
 #endif
 
-    // Snapshot valid task IDs to protect against callbacks modifying the task array.
-    // Without this, a callback could delete/create tasks and corrupt iteration.
-    int8_t snapshot[ARDA_MAX_TASKS];
-    int8_t snapshotCount = 0;
-    for (int8_t i = 0; i < taskCount; i++) {
-        if (!isDeleted(tasks[i])) {
-            snapshot[snapshotCount++] = i;
-        }
-    }
-
-    // Reset ranThisCycle flags at start of each run() cycle (skipTask < 0).
-    // When called from yield() (skipTask >= 0), preserve ranThisCycle flags to
+    // Reset ranThisCycle marks at start of each run() cycle (skipTask < 0): one
+    // memset of the dense ranMask_, not a write to every task.
+    // When called from yield() (skipTask >= 0), preserve ranThisCycle marks to
     // prevent tasks from running multiple times in the same top-level cycle.
-    // Note: yield() handles clearing stale flags from previous cycles when called
+    // Note: yield() handles clearing stale marks from previous cycles when called
     // outside run() - see yield() implementation.
+    // The dispatch loop below never iterates the task table itself - it consumes
+    // ready masks and rebuilds them whenever readyGen_ moves, and re-validates
+    // every ID it takes, so tasks created or deleted by a callback cannot corrupt it.
     if (skipTask < 0) {
-        for (int8_t j = 0; j < snapshotCount; j++) {
-            int8_t i = snapshot[j];
-            if (isValidTask(i)) {
-                updateRanThisCycle(tasks[i], false);
-            }
-        }
+        memset(ranMask_, 0, sizeof(ranMask_));
+#if ARDA_MAX_DEPENDENCIES > 0
+        memset(triggeredMask_, 0, sizeof(triggeredMask_));
+#endif
     }
 
 #ifndef ARDA_NO_PRIORITY
-    // Priority-based scheduling: repeatedly find and run highest-priority ready task
-    bool taskRan = true;
-    while (taskRan) {
-        taskRan = false;
-        int8_t bestTask = -1;
-        uint8_t bestPriority = 0;
-
-        // Find highest-priority ready task
-        for (int8_t j = 0; j < snapshotCount; j++) {
-            int8_t i = snapshot[j];
-            if (i == skipTask) continue;
-            if (!isValidTask(i)) continue;
-            if (extractState(tasks[i]) != TaskState::Running) continue;
-            if (tasks[i].loop == nullptr) continue;
-            if (checkRanThisCycle(tasks[i])) continue;
-            if (tasks[i].interval != 0 && (millis() - tasks[i].lastRun < tasks[i].interval)) continue;
-
-            uint8_t priority = extractPriority(tasks[i]);
-            if (bestTask < 0 || priority > bestPriority) {
-                bestTask = i;
-                bestPriority = priority;
-            }
+    // Priority-based scheduling from per-level ready bitmaps: each dispatch is a
+    // find-first-set from the highest level down (lowest ID wins within a level,
+    // matching snapshot order) instead of a rescan of every task.
+#else
+    // Array-order scheduling (ARDA_NO_PRIORITY): a single ready level, consumed
+    // in one ascending pass - a task whose ID is below the last dispatched one
+    // waits for the next cycle, exactly like a plain array scan.
+    int8_t cursor = -1;
+#endif
+    // Masks are filled from everyCycleMask_ plus the due prefix of the deadline
+    // heap, so tasks whose interval has not elapsed are never touched.
+    uint8_t readyMask[ARDA_READY_LEVELS][ARDA_TASK_MASK_BYTES];
+    // One clock read per dispatch decision: 'now' is taken here and then from the
+    // end of each dispatched loop(), and doubles as that task's execution start.
+    // Microsecond tasks are timed separately, and only read that clock while queued.
+    uint32_t now = clock_();
+    uint32_t nowUs = dueCount_[HEAP_US] ? ardaMicrosClock() : 0;
+    uint32_t scanTime = now;
+    uint32_t scanTimeUs = nowUs;
+    uint32_t nextDueInUs;
+    uint8_t scanGen = readyGen_;
+    // Tasks the previous run() ran out of budget for are filed with everything
+    // else (buildReadyMasks_) and go first within their own level
+    bool carrying = false;
+    if (skipTask < 0) {
+        for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+            if (carryMask_[b]) carrying = true;
         }
-
-        if (bestTask >= 0) {
-            int8_t i = bestTask;
-            // Guard against excessive callback nesting (prevents stack overflow)
-            if (callbackDepth >= ARDA_MAX_CALLBACK_DEPTH) {
-                // Can't run any more tasks this cycle due to depth limit
-                break;
-            }
-            taskRan = true;
-            int8_t prevTask = currentTask;
-            currentTask = i;
-
-            emitTrace(i, TraceEvent::TaskLoopBegin);
-            uint32_t execStart = millis();
-
-            // ARDA_WATCHDOG and ARDA_TASK_RECOVERY can be enabled together
-#ifdef ARDA_WATCHDOG
-            wdt_reset();
+    }
+    uint32_t nextDueIn = buildReadyMasks_(readyMask, skipTask, scanTime, scanTimeUs, nextDueInUs);
+    bool outOfBudget = false;
+    uint32_t budgetStartUs = cycleBudgetUs_ ? ardaMicrosClock() : 0;
+#ifdef ARDA_CHILD_SCHEDULERS
+    if (skipTask < 0) budgetStartUs_ = budgetStartUs;  // For mounted children (budgetLeftUs_)
 #endif
 
-#ifdef ARDA_TASK_RECOVERY
-#if ARDA_TASK_RECOVERY_IMPL
-            bool wasAborted = false;
-            uint32_t cachedTimeout = tasks[i].timeout;  // Cache before potential invalidation
-            bool recEnabled = recoveryEnabled_;  // Cache volatile read once per task
-
-            // Mark as run BEFORE any execution - must happen for ALL tasks (even timeout=0)
-            updateRanThisCycle(tasks[i], true);
-
-            // Check global enable AND per-task timeout
-            if (recEnabled && cachedTimeout > 0) {
-                // Save state that may be corrupted by longjmp
-                uint8_t savedCallbackDepth = callbackDepth;
-
-                if (setjmp(recoveryJumpBuf_) == 0) {
-                    // Normal path - arm timer AFTER setjmp establishes jump point
-                    recoveryInCallback_ = false;
-                    armRecoveryTimer(i, cachedTimeout);
-                    callbackDepth++;  // Track callback depth for loop()
-                    tasks[i].loop();
-                    callbackDepth--;
-                    disarmRecoveryTimer();
-                } else {
-                    // longjmp landed here - INTERRUPTS ARE DISABLED!
-                    disarmRecoveryTimer();
-                    sei();  // Re-enable interrupts (longjmp doesn't restore SREG on AVR)
-                    callbackDepth = savedCallbackDepth;  // Restore corrupted depth
-
-                    // Re-validate task - could have been invalidated before timeout fired
-                    if (!isValidTask(i)) {
-                        recoveryInCallback_ = false;
-                        wasAborted = true;
-                    } else if (!recoveryInCallback_) {
-                        // Task itself timed out - try recover()
-                        wasAborted = true;
-                        error_ = ArdaError::TaskAborted;
-                        emitTrace(i, TraceEvent::TaskAborted);
+    while (true) {
+        // Rebuild if a callback made a task newly eligible (start, resume, priority
+        // or interval change) or if the earliest queued deadline has passed since
+        // the last build - readiness always reflects the time after the last loop().
+        if (scanGen != readyGen_ || now - scanTime >= nextDueIn ||
+            (dueCount_[HEAP_US] > 0 && nowUs - scanTimeUs >= nextDueInUs)) {
+            scanTime = now;
+            scanTimeUs = nowUs;
+            scanGen = readyGen_;
+            nextDueIn = buildReadyMasks_(readyMask, skipTask, scanTime, scanTimeUs, nextDueInUs);
+        }
 
-#ifdef ARDA_SHELL_ACTIVE
-                        // Clear partial shell command buffer if shell task was aborted
-                        if (i == ARDA_SHELL_TASK_ID) {
-                            shellBufIdx_ = 0;
-                        }
+#ifdef ARDA_EDF
+        bool edf = (policy_ == SchedulerPolicy::Edf);
+        int8_t i = edf ? takeEarliestDeadline_(readyMask, now)
+                       : takeReadyTask(readyMask, carrying ? carryMask_ : nullptr);
+#else
+        int8_t i = takeReadyTask(readyMask, carrying ? carryMask_ : nullptr);
 #endif
-
-                        if (tasks[i].recover) {
-                            // Arm timer again for recover() - use current timeout
-                            // (task may have adjusted it mid-loop via setTaskTimeout)
-                            if (setjmp(recoveryJumpBuf_) == 0) {
-                                recoveryInCallback_ = true;
-                                armRecoveryTimer(i, tasks[i].timeout);
-                                callbackDepth++;  // Track callback depth for recover()
-                                tasks[i].recover();
-                                callbackDepth--;
-                                disarmRecoveryTimer();
-                                recoveryInCallback_ = false;
-                            } else {
-                                // recover() also timed out - longjmp landed here
-                                disarmRecoveryTimer();
-                                sei();
-                                callbackDepth--;  // Undo recover() increment
-                                recoveryInCallback_ = false;
-                                emitTrace(i, TraceEvent::RecoverAborted);
-                            }
-                        }
-                    }
-                }
-            } else {
-                // No timeout set - run without recovery protection
-                // (updateRanThisCycle already called above for ALL tasks)
-                callbackDepth++;
-                tasks[i].loop();
-                callbackDepth--;
+        if (i < 0) break;  // Nothing left to run this cycle
+        bool carried = false;
+        if (carrying) {
+            // Taken (run or dropped as stale): no longer owed anything
+            carried = (carryMask_[i >> 3] & (1 << (i & 7))) != 0;
+            carryMask_[i >> 3] &= (uint8_t)~(1 << (i & 7));
+            carrying = false;
+            for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+                if (carryMask_[b]) carrying = true;
             }
-#else
-            // Hardware doesn't support recovery - run task normally
-            updateRanThisCycle(tasks[i], true);
-            callbackDepth++;
-            tasks[i].loop();
-            callbackDepth--;
+        }
+#ifdef ARDA_NO_PRIORITY
+#ifdef ARDA_EDF
+        if (!edf) {
+#endif
+        if (carried) {
+            if (!carrying) cursor = -1;  // Carried tasks were out of order; start the array pass
+        } else {
+            if (i <= cursor) continue;  // Already passed in this cycle's array order
+            cursor = i;
+        }
+#ifdef ARDA_EDF
+        }
 #endif
 #else
-            // ARDA_TASK_RECOVERY not enabled - original code
-            updateRanThisCycle(tasks[i], true);
-            callbackDepth++;
-            tasks[i].loop();
-            callbackDepth--;
+        (void)carried;
 #endif
 
-            uint32_t execDuration = millis() - execStart;
-            emitTrace(i, TraceEvent::TaskLoopEnd);
-
-            currentTask = prevTask;
-
-            // Update run statistics (happens for both normal and aborted tasks)
-#ifdef ARDA_TASK_RECOVERY
-#if ARDA_TASK_RECOVERY_IMPL
-            if (isValidTask(i)) {
-#endif
+        // Bits can be stale if an earlier task stopped, paused, deleted or ran
+        // (via yield) this one since the masks were built - drop those entries.
+        if (!isValidTask(i)) continue;
+        if (extractState(tasks[i]) != TaskState::Running) continue;
+        if (taskLoop(tasks[i]) == nullptr) continue;
+        if (checkRanThisCycle_(i)) continue;  // Already ran this cycle (prevents double execution from yield)
+#if ARDA_MAX_GROUPS > 0
+        if (isHeld_(i)) continue;  // Group paused since the masks were built
 #endif
-                if (++tasks[i].runCount == 0) tasks[i].runCount = 1;  // Skip 0 on overflow
-                tasks[i].lastRun = execStart;
-#ifdef ARDA_TASK_RECOVERY
-#if ARDA_TASK_RECOVERY_IMPL
-            }
+#if ARDA_MAX_DEPENDENCIES > 0
+        // Run-after edges: a 'before' task still due this cycle runs first (i goes
+        // back into the masks), and a gated task whose input did not run is dropped
+        if (depTasks_[i >> 3] & (1 << (i & 7))) {
+            int8_t deferred;
+            i = depResolve_(readyMask, i, deferred);
+#ifdef ARDA_NO_PRIORITY
+            if (deferred <= cursor) cursor = deferred - 1;  // Deferred tasks stay in this pass
 #endif
+            if (i < 0) continue;
+        }
 #endif
 
-#ifdef ARDA_TASK_RECOVERY
-#if ARDA_TASK_RECOVERY_IMPL
-            // Skip soft timeout callback if task was hard-aborted (already notified via trace)
-            // Use current timeout if task is still valid (may have been adjusted mid-loop)
-            if (wasAborted) {
-                execDuration = isValidTask(i) ? tasks[i].timeout : cachedTimeout;
-            }
-            // Only fire timeout callback if recovery enabled (re-read in case task disabled it mid-loop), NOT aborted
-            // Use current tasks[i].timeout (not cachedTimeout) in case task adjusted it mid-loop
-            uint32_t finalTimeout = tasks[i].timeout;
-            if (recoveryEnabled_ && !wasAborted && finalTimeout > 0 && execDuration > finalTimeout
-                && timeoutCallback && callbackDepth < ARDA_MAX_CALLBACK_DEPTH) {
-                callbackDepth++;
-                timeoutCallback(i, execDuration);
-                callbackDepth--;
-            }
+        // Guard against excessive callback nesting (prevents stack overflow)
+        if (callbackDepth >= ARDA_MAX_CALLBACK_DEPTH) {
+            // Can't run any more tasks this cycle due to depth limit
+            break;
+        }
+        now = dispatchTask_(i, now);
+        if (dueCount_[HEAP_US]) nowUs = ardaMicrosClock();
+#if ARDA_MAX_DEPENDENCIES > 0
+        if (depTasks_[i >> 3] & (1 << (i & 7))) {
+#ifdef ARDA_NO_PRIORITY
+            int8_t released = depRelease_(readyMask, i);
+            if (released <= cursor) cursor = released - 1;  // Triggered tasks run this pass
 #else
-            // Non-AVR: software timeout callback only (no hardware abort)
-            // Check recoveryEnabled_ to honor setTaskRecoveryEnabled()
-            if (recoveryEnabled_ && tasks[i].timeout > 0 && execDuration > tasks[i].timeout
-                && timeoutCallback != nullptr && callbackDepth < ARDA_MAX_CALLBACK_DEPTH) {
-                callbackDepth++;
-                timeoutCallback(i, execDuration);
-                callbackDepth--;
-            }
+            depRelease_(readyMask, i);
 #endif
+        }
 #endif
 
-#ifdef ARDA_SHELL_ACTIVE
-            // Handle deferred self-deletion (e.g., shell killing itself with 'k 0')
-            if (pendingSelfDelete_ == i) {
-                pendingSelfDelete_ = -1;
-                if (deleteTask(i)) {  // Safe now since currentTask has been restored
-                    if (i == ARDA_SHELL_TASK_ID) shellDeleted_ = true;
+        // Out of budget: whatever is still ready is owed a run, first thing next run().
+        // Only the top-level cycle is bounded; yield() runs keep their old behaviour.
+        if (cycleBudgetUs_ && skipTask < 0 && ardaMicrosClock() - budgetStartUs >= cycleBudgetUs_) {
+            int8_t id;
+            outOfBudget = true;
+            memset(carryMask_, 0, sizeof(carryMask_));
+            while ((id = takeReadyTask(readyMask, nullptr)) >= 0) {
+#if ARDA_MAX_GROUPS > 0
+                if (isHeld_(id)) continue;
+#endif
+                if (!checkRanThisCycle_(id)) setMaskBit(carryMask_, id);
+            }
+            break;
+        }
+    }
+    // Carried tasks that were not reached (paused, stopped or no longer ready)
+    // lose their claim unless the budget cut this cycle short again
+    if (skipTask < 0 && !outOfBudget) memset(carryMask_, 0, sizeof(carryMask_));
+
+    flags_ &= ~FLAG_IN_RUN;
+}
+
+#ifdef ARDA_EDF
+// EDF pick: the ready task with the least slack to its absolute deadline
+// (lastRun + relative deadline, or + interval if none). Slack is compared in ms
+// so microsecond and millisecond tasks mix. Scanning levels from the top with a
+// strict '<' breaks ties by higher level, then lower ID - same as Priority.
+int8_t Arda::takeEarliestDeadline_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], uint32_t now) {
+    int8_t best = -1;
+    uint8_t bestLevel = 0;
+    int32_t bestSlack = 0;
+    uint32_t nowUs = 0;
+    bool haveUs = false;
+    for (int8_t p = ARDA_READY_LEVELS - 1; p >= 0; p--) {
+        for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+            uint8_t bits = readyMask[p][b];
+            while (bits) {
+                int8_t id = (int8_t)((b << 3) + __builtin_ctz(bits));
+                bits &= (uint8_t)(bits - 1);
+                const Task& t = tasks[id];
+                uint32_t due = t.lastRun + (t.deadline ? t.deadline : t.interval);
+                int32_t slack;
+                if (t.flags & ARDA_TASK_MICROS_BIT) {
+                    if (!haveUs) {
+                        nowUs = ardaMicrosClock();
+                        haveUs = true;
+                    }
+                    slack = (int32_t)(due - nowUs) / 1000;
+                } else {
+                    slack = (int32_t)(due - now);
+                }
+                if (best < 0 || slack < bestSlack) {
+                    best = id;
+                    bestLevel = (uint8_t)p;
+                    bestSlack = slack;
                 }
-                // If deletion fails (e.g., teardown restarted task), shellDeleted_ stays false
             }
+        }
+    }
+    if (best >= 0) {
+        readyMask[bestLevel][best >> 3] &= (uint8_t)~(1 << (best & 7));
+    }
+    return best;
+}
 #endif
+
+// Fill readyMask with every eligible task that is due at 'now': interval-0 tasks
+// come straight from everyCycleMask_, interval tasks from the due prefix of the
+// deadline heaps ('now' for millisecond tasks, 'nowUs' for microsecond tasks).
+// Returns ms until the earliest queued millisecond task that is not yet due
+// becomes due (UINT32_MAX if none) and the same in us via nextDueInUs, so
+// runInternal() knows when to rebuild.
+uint32_t Arda::buildReadyMasks_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], int8_t skipTask,
+                                uint32_t now, uint32_t nowUs, uint32_t& nextDueInUs) {
+    memcpy(readyMask, everyCycleMask_, sizeof(everyCycleMask_));
+    uint32_t nextDueIn = UINT32_MAX;
+    nextDueInUs = UINT32_MAX;
+    if (dueCount_[HEAP_MS] > 0) {
+        collectDue_(readyMask, HEAP_MS, 0, now, nextDueIn);
+    }
+    if (dueCount_[HEAP_US] > 0) {
+        collectDue_(readyMask, HEAP_US, 0, nowUs, nextDueInUs);
+    }
+    // Tasks a cycle budget cut off are owed a run even if no longer due
+    for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+        uint8_t bits = carryMask_[b];
+        while (bits) {
+            int8_t id = (int8_t)((b << 3) + __builtin_ctz(bits));
+            bits &= (uint8_t)(bits - 1);
+            setMaskBit(readyMask[readyLevel(tasks[id])], id);
+        }
+    }
+#if ARDA_MAX_DEPENDENCIES > 0
+    // Tasks an onlyIfRan edge released earlier in this cycle survive rebuilds
+    for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+        uint8_t bits = triggeredMask_[b];
+        while (bits) {
+            int8_t id = (int8_t)((b << 3) + __builtin_ctz(bits));
+            bits &= (uint8_t)(bits - 1);
+            setMaskBit(readyMask[readyLevel(tasks[id])], id);
+        }
+    }
+#endif
+    if (skipTask >= 0) {
+        for (uint8_t p = 0; p < ARDA_READY_LEVELS; p++) {
+            readyMask[p][skipTask >> 3] &= (uint8_t)~(1 << (skipTask & 7));
         }
     }
+    return nextDueIn;
+}
+
+// Ready level for a due task 'elapsed' (task's unit) after its last run: its
+// priority, raised one level per agingStepMs_ it is overdue when aging is on.
+uint8_t Arda::readyLevel_(int8_t id, uint32_t elapsed) const {
+    const Task& task = tasks[id];
+    uint8_t level = readyLevel(task);
+#ifndef ARDA_NO_PRIORITY
+    if (agingStepMs_ == 0 || elapsed <= task.interval) return level;  // Not overdue
+    uint32_t overdue = elapsed - task.interval;
+    if (task.flags & ARDA_TASK_MICROS_BIT) overdue /= 1000;
+    uint32_t steps = overdue / agingStepMs_;
+    constexpr uint8_t maxLevel = ARDA_PRIORITY_LEVELS - 1;
+    return (steps >= (uint32_t)(maxLevel - level)) ? maxLevel : (uint8_t)(level + steps);
 #else
-    // Original array-order scheduling (when ARDA_NO_PRIORITY is defined)
-    for (int8_t j = 0; j < snapshotCount; j++) {
-        int8_t i = snapshot[j];
-        if (i == skipTask) continue;  // Skip specified task (for yield)
-        if (!isValidTask(i)) continue;  // Task was deleted during iteration
-        if (extractState(tasks[i]) != TaskState::Running) continue;
-        if (tasks[i].loop == nullptr) continue;
-        if (checkRanThisCycle(tasks[i])) continue;  // Already ran this cycle (prevents double execution from yield)
-
-        // Check if it's time to run this task
-        if (tasks[i].interval == 0 || (millis() - tasks[i].lastRun >= tasks[i].interval)) {
-            // Guard against excessive callback nesting (prevents stack overflow)
-            if (callbackDepth >= ARDA_MAX_CALLBACK_DEPTH) {
-                continue;  // Skip this task for now, will try again next cycle
-            }
-            int8_t prevTask = currentTask;
-            currentTask = i;
+    (void)elapsed;
+    return level;
+#endif
+}
+
+// Depth-first walk of the heap: a due node's children may be due, a waiting
+// node's subtree is not (heap order), so only due tasks plus one frontier
+// node per branch are visited. Recursion depth is bounded by the heap height.
+void Arda::collectDue_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], uint8_t heap, int16_t pos,
+                       uint32_t now, uint32_t& nextDueIn) const {
+    if (pos >= dueCount_[heap]) return;
+    int8_t id = dueHeap_[heap][pos];
+    uint32_t elapsed = now - tasks[id].lastRun;
+    if (elapsed < tasks[id].interval) {
+        uint32_t remaining = tasks[id].interval - elapsed;
+        if (remaining < nextDueIn) nextDueIn = remaining;
+        return;
+    }
+    setMaskBit(readyMask[readyLevel_(id, elapsed)], id);
+    collectDue_(readyMask, heap, 2 * pos + 1, now, nextDueIn);
+    collectDue_(readyMask, heap, 2 * pos + 2, now, nextDueIn);
+}
+
+inline void Arda::callLoop_(int8_t id) {
+#ifdef ARDA_PROTOTHREADS
+    if (tasks[id].mode & (ARDA_MODE_PT_SLEEP_BIT | ARDA_MODE_PT_EVENT_BIT)) ptWake_(id);
+#endif
+#ifdef ARDA_COROUTINES
+    if (tasks[id].mode & ARDA_MODE_CORO_BIT) {
+        coroResume_(id);
+        return;
+    }
+#endif
+    callTask_(id, taskLoop(tasks[id]));
+}
+
+inline void Arda::callTask_(int8_t id, TaskCallback cb) {
+#ifdef ARDA_TASK_CONTEXT
+    if (tasks[id].mode & ARDA_MODE_CONTEXT_BIT) {
+        // Stored as TaskCallback; cast back to the type it was created with
+        reinterpret_cast<TaskContextCallback>(cb)(tasks[id].context);
+        return;
+    }
+#else
+    (void)id;
+#endif
+    cb();
+}
+
+// Execute one task's loop() with trace, watchdog and recovery handling, then
+// update its run statistics. Caller has already checked readiness and depth.
+// 'now' is the clock reading the dispatch decision was made on; it becomes the
+// task's lastRun. Returns the clock read after loop() for the next decision.
+uint32_t Arda::dispatchTask_(int8_t i, uint32_t now) {
+    int8_t prevTask = currentTask;
+    currentTask = i;
 
-            emitTrace(i, TraceEvent::TaskLoopBegin);
-            uint32_t execStart = millis();
+    emitTrace(i, TraceEvent::TaskLoopBegin);
+    uint32_t execStart = now;
+    // Microsecond tasks record lastRun on their own clock
+    uint32_t runStart = (tasks[i].flags & ARDA_TASK_MICROS_BIT) ? ardaMicrosClock() : now;
 
-            // ARDA_WATCHDOG and ARDA_TASK_RECOVERY can be enabled together
+    // ARDA_WATCHDOG and ARDA_TASK_RECOVERY can be enabled together
 #ifdef ARDA_WATCHDOG
-            wdt_reset();
+    wdt_reset();
 #endif
 
 #ifdef ARDA_TASK_RECOVERY
 #if ARDA_TASK_RECOVERY_IMPL
-            bool wasAborted = false;
-            uint32_t cachedTimeout = tasks[i].timeout;  // Cache before potential invalidation
-            bool recEnabled = recoveryEnabled_;  // Cache volatile read once per task
-
-            // Mark as run BEFORE any execution - must happen for ALL tasks (even timeout=0)
-            updateRanThisCycle(tasks[i], true);
-
-            // Check global enable AND per-task timeout
-            if (recEnabled && cachedTimeout > 0) {
-                // Save state that may be corrupted by longjmp
-                uint8_t savedCallbackDepth = callbackDepth;
-
-                if (setjmp(recoveryJumpBuf_) == 0) {
-                    // Normal path - arm timer AFTER setjmp establishes jump point
-                    recoveryInCallback_ = false;
-                    armRecoveryTimer(i, cachedTimeout);
-                    callbackDepth++;  // Track callback depth for loop()
-                    tasks[i].loop();
-                    callbackDepth--;
-                    disarmRecoveryTimer();
-                } else {
-                    // longjmp landed here - INTERRUPTS ARE DISABLED!
-                    disarmRecoveryTimer();
-                    sei();  // Re-enable interrupts (longjmp doesn't restore SREG on AVR)
-                    callbackDepth = savedCallbackDepth;  // Restore corrupted depth
-
-                    // Re-validate task - could have been invalidated before timeout fired
-                    if (!isValidTask(i)) {
-                        recoveryInCallback_ = false;
-                        wasAborted = true;
-                    } else if (!recoveryInCallback_) {
-                        // Task itself timed out - try recover()
-                        wasAborted = true;
-                        error_ = ArdaError::TaskAborted;
-                        emitTrace(i, TraceEvent::TaskAborted);
+    bool wasAborted = false;
+    uint32_t cachedTimeout = tasks[i].timeout;  // Cache before potential invalidation
+    bool recEnabled = recoveryEnabled_;  // Cache volatile read once per task
+
+    // Mark as run BEFORE any execution - must happen for ALL tasks (even timeout=0)
+    updateRanThisCycle_(i, true);
+
+    // Check global enable AND per-task timeout
+    if (recEnabled && cachedTimeout > 0) {
+        // Save state that may be corrupted by longjmp
+        uint8_t savedCallbackDepth = callbackDepth;
+
+        if (setjmp(recoveryJumpBuf_) == 0) {
+            // Normal path - arm timer AFTER setjmp establishes jump point
+            recoveryInCallback_ = false;
+            armRecoveryTimer(i, cachedTimeout);
+            callbackDepth++;  // Track callback depth for loop()
+            callLoop_(i);
+            callbackDepth--;
+            disarmRecoveryTimer();
+        } else {
+            // longjmp landed here - INTERRUPTS ARE DISABLED!
+            disarmRecoveryTimer();
+            sei();  // Re-enable interrupts (longjmp doesn't restore SREG on AVR)
+            callbackDepth = savedCallbackDepth;  // Restore corrupted depth
+
+            // Re-validate task - could have been invalidated before timeout fired
+            if (!isValidTask(i)) {
+                recoveryInCallback_ = false;
+                wasAborted = true;
+            } else if (!recoveryInCallback_) {
+                // Task itself timed out - try recover()
+                wasAborted = true;
+                error_ = ArdaError::TaskAborted;
+                emitTrace(i, TraceEvent::TaskAborted);
 
 #ifdef ARDA_SHELL_ACTIVE
-                        // Clear partial shell command buffer if shell task was aborted
-                        if (i == ARDA_SHELL_TASK_ID) {
-                            shellBufIdx_ = 0;
-                        }
+                // Clear partial shell command buffer if shell task was aborted
+                if (i == ARDA_SHELL_TASK_ID) {
+                    shellBufIdx_ = 0;
+                }
 #endif
 
-                        if (tasks[i].recover) {
-                            // Arm timer again for recover() - use current timeout
-                            // (task may have adjusted it mid-loop via setTaskTimeout)
-                            if (setjmp(recoveryJumpBuf_) == 0) {
-                                recoveryInCallback_ = true;
-                                armRecoveryTimer(i, tasks[i].timeout);
-                                callbackDepth++;  // Track callback depth for recover()
-                                tasks[i].recover();
-                                callbackDepth--;
-                                disarmRecoveryTimer();
-                                recoveryInCallback_ = false;
-                            } else {
-                                // recover() also timed out - longjmp landed here
-                                disarmRecoveryTimer();
-                                sei();
-                                callbackDepth--;  // Undo recover() increment
-                                recoveryInCallback_ = false;
-                                emitTrace(i, TraceEvent::RecoverAborted);
-                            }
-                        }
+                if (tasks[i].recover) {
+                    // Arm timer again for recover() - use current timeout
+                    // (task may have adjusted it mid-loop via setTaskTimeout)
+                    if (setjmp(recoveryJumpBuf_) == 0) {
+                        recoveryInCallback_ = true;
+                        armRecoveryTimer(i, tasks[i].timeout);
+                        callbackDepth++;  // Track callback depth for recover()
+                        tasks[i].recover();
+                        callbackDepth--;
+                        disarmRecoveryTimer();
+                        recoveryInCallback_ = false;
+                    } else {
+                        // recover() also timed out - longjmp landed here
+                        disarmRecoveryTimer();
+                        sei();
+                        callbackDepth--;  // Undo recover() increment
+                        recoveryInCallback_ = false;
+                        emitTrace(i, TraceEvent::RecoverAborted);
                     }
                 }
-            } else {
-                // No timeout set - run without recovery protection
-                // (updateRanThisCycle already called above for ALL tasks)
-                callbackDepth++;
-                tasks[i].loop();
-                callbackDepth--;
             }
+        }
+    } else {
+        // No timeout set - run without recovery protection
+        // (updateRanThisCycle already called above for ALL tasks)
+        callbackDepth++;
+        callLoop_(i);
+        callbackDepth--;
+    }
 #else
-            // Hardware doesn't support recovery - run task normally
-            updateRanThisCycle(tasks[i], true);
-            callbackDepth++;
-            tasks[i].loop();
-            callbackDepth--;
+    // Hardware doesn't support recovery - run task normally
+    updateRanThisCycle_(i, true);
+    callbackDepth++;
+    callLoop_(i);
+    callbackDepth--;
 #endif
 #else
-            // ARDA_TASK_RECOVERY not enabled - original code
-            updateRanThisCycle(tasks[i], true);
-            callbackDepth++;
-            tasks[i].loop();
-            callbackDepth--;
+    // ARDA_TASK_RECOVERY not enabled - original code
+    updateRanThisCycle_(i, true);
+    callbackDepth++;
+    callLoop_(i);
+    callbackDepth--;
 #endif
 
-            uint32_t execDuration = millis() - execStart;
-            emitTrace(i, TraceEvent::TaskLoopEnd);
+    uint32_t execEnd = clock_();
+    uint32_t execDuration = execEnd - execStart;
+    emitTrace(i, TraceEvent::TaskLoopEnd);
 
-            currentTask = prevTask;
+    currentTask = prevTask;
 
-            // Update run statistics (happens for both normal and aborted tasks)
+    // Update run statistics (happens for both normal and aborted tasks)
 #ifdef ARDA_TASK_RECOVERY
 #if ARDA_TASK_RECOVERY_IMPL
-            if (isValidTask(i)) {
+    if (isValidTask(i)) {
+#endif
 #endif
+        if (++tasks[i].runCount == 0) tasks[i].runCount = 1;  // Skip 0 on overflow
+#ifdef ARDA_PROTOTHREADS
+        if (!(tasks[i].mode & ARDA_MODE_PT_SLEEP_BIT))  // ARDA_SLEEP timed it from its own call
 #endif
-                if (++tasks[i].runCount == 0) tasks[i].runCount = 1;  // Skip 0 on overflow
-                tasks[i].lastRun = execStart;
+        advanceLastRun_(i, runStart);
+#ifdef ARDA_COROUTINES
+        if (tasks[i].mode & ARDA_MODE_CORO_BIT) coroApplySleep_(i);
+#endif
+        schedUpdate_(i);  // Re-key the deadline from the new lastRun
 #ifdef ARDA_TASK_RECOVERY
 #if ARDA_TASK_RECOVERY_IMPL
-            }
+    }
 #endif
 #endif
 
 #ifdef ARDA_TASK_RECOVERY
 #if ARDA_TASK_RECOVERY_IMPL
-            // Skip soft timeout callback if task was hard-aborted (already notified via trace)
-            // Use current timeout if task is still valid (may have been adjusted mid-loop)
-            if (wasAborted) {
-                execDuration = isValidTask(i) ? tasks[i].timeout : cachedTimeout;
-            }
-            // Only fire timeout callback if recovery enabled (re-read in case task disabled it mid-loop), NOT aborted
-            // Use current tasks[i].timeout (not cachedTimeout) in case task adjusted it mid-loop
-            uint32_t finalTimeout = tasks[i].timeout;
-            if (recoveryEnabled_ && !wasAborted && finalTimeout > 0 && execDuration > finalTimeout
-                && timeoutCallback && callbackDepth < ARDA_MAX_CALLBACK_DEPTH) {
-                callbackDepth++;
-                timeoutCallback(i, execDuration);
-                callbackDepth--;
-            }
+    // Skip soft timeout callback if task was hard-aborted (already notified via trace)
+    // Use current timeout if task is still valid (may have been adjusted mid-loop)
+    if (wasAborted) {
+        execDuration = isValidTask(i) ? tasks[i].timeout : cachedTimeout;
+    }
+    // Only fire timeout callback if recovery enabled (re-read in case task disabled it mid-loop), NOT aborted
+    // Use current tasks[i].timeout (not cachedTimeout) in case task adjusted it mid-loop
+    uint32_t finalTimeout = tasks[i].timeout;
+    if (recoveryEnabled_ && !wasAborted && finalTimeout > 0 && execDuration > finalTimeout
+        && timeoutCallback && callbackDepth < ARDA_MAX_CALLBACK_DEPTH) {
+        callbackDepth++;
+        timeoutCallback(i, execDuration);
+        callbackDepth--;
+    }
 #else
-            // Non-AVR: software timeout callback only (no hardware abort)
-            // Check recoveryEnabled_ to honor setTaskRecoveryEnabled()
-            if (recoveryEnabled_ && tasks[i].timeout > 0 && execDuration > tasks[i].timeout
-                && timeoutCallback != nullptr && callbackDepth < ARDA_MAX_CALLBACK_DEPTH) {
-                callbackDepth++;
-                timeoutCallback(i, execDuration);
-                callbackDepth--;
-            }
+    // Non-AVR: software timeout callback only (no hardware abort)
+    // Check recoveryEnabled_ to honor setTaskRecoveryEnabled()
+    if (recoveryEnabled_ && tasks[i].timeout > 0 && execDuration > tasks[i].timeout
+        && timeoutCallback != nullptr && callbackDepth < ARDA_MAX_CALLBACK_DEPTH) {
+        callbackDepth++;
+        timeoutCallback(i, execDuration);
+        callbackDepth--;
+    }
 #endif
 #endif
 
 #ifdef ARDA_SHELL_ACTIVE
-            // Handle deferred self-deletion (e.g., shell killing itself with 'k 0')
-            if (pendingSelfDelete_ == i) {
-                pendingSelfDelete_ = -1;
-                if (deleteTask(i)) {  // Safe now since currentTask has been restored
-                    if (i == ARDA_SHELL_TASK_ID) shellDeleted_ = true;
-                }
-                // If deletion fails (e.g., teardown restarted task), shellDeleted_ stays false
-            }
-#endif
+    // Handle deferred self-deletion (e.g., shell killing itself with 'k 0')
+    if (pendingSelfDelete_ == i) {
+        pendingSelfDelete_ = -1;
+        if (deleteTask(i)) {  // Safe now since currentTask has been restored
+            if (i == ARDA_SHELL_TASK_ID) shellDeleted_ = true;
         }
+        // If deletion fails (e.g., teardown restarted task), shellDeleted_ stays false
     }
 #endif
-
-    flags_ &= ~FLAG_IN_RUN;
+    return execEnd;
 }
 
 bool Arda::reset(bool preserveCallbacks) {
@@ -820,21 +1243,47 @@ bool Arda::reset(bool preserveCallbacks) {
     }
 
     // Clear all task slots
+#ifdef ARDA_NAME_INDEX
+    nameIndexClear_();
+#endif
     for (int8_t i = 0; i < ARDA_MAX_TASKS; i++) {
+#ifdef ARDA_CHILD_SCHEDULERS
+        Arda* child = getChildScheduler(i);
+        if (child) child->parent_ = nullptr;  // Unmounted: free to mount elsewhere
+#endif
+#ifdef ARDA_TABLE_TASKS
+        tasks[i].def = nullptr;
+#else
         tasks[i].setup = nullptr;
         tasks[i].loop = nullptr;
         tasks[i].teardown = nullptr;
+#endif
+#ifdef ARDA_TASK_CONTEXT
+        tasks[i].context = nullptr;
+#endif
 #ifdef ARDA_TASK_RECOVERY
         tasks[i].recover = nullptr;
 #endif
         tasks[i].interval = 0;
         tasks[i].lastRun = 0;
         tasks[i].runCount = 0;    // Union member; nextFree shares this memory
+        tasks[i].notify = 0;
+        tasks[i].mode = 0;
+#ifdef ARDA_PROTOTHREADS
+        tasks[i].ptInterval = 0;
+        tasks[i].resume = 0;
+#endif
 #ifdef ARDA_TASK_RECOVERY
         tasks[i].timeout = 0;
 #endif
-#ifdef ARDA_NO_NAMES
+#ifdef ARDA_EDF
+        tasks[i].deadline = 0;
+#endif
+#ifdef ARDA_TASK_DELETED_STATE
         // Mark as deleted using state value 3
+  #if defined(ARDA_FLASH_NAMES) && !defined(ARDA_TABLE_TASKS)
+        tasks[i].name = nullptr;
+  #endif
   #ifndef ARDA_NO_PRIORITY
         tasks[i].flags = (ARDA_DEFAULT_PRIORITY << ARDA_TASK_PRIORITY_SHIFT) | ARDA_TASK_DELETED_STATE;
   #else
@@ -845,11 +1294,26 @@ bool Arda::reset(bool preserveCallbacks) {
   #ifndef ARDA_NO_PRIORITY
         tasks[i].flags = ARDA_DEFAULT_PRIORITY << ARDA_TASK_PRIORITY_SHIFT;
   #else
-        tasks[i].flags = 0;       // state=Stopped, ranThisCycle=false, inYield=false
+        tasks[i].flags = 0;       // state=Stopped, autoStart=false, inYield=false
   #endif
 #endif
     }
 
+    schedClear_();      // Every task is Stopped - nothing left to schedule
+#if ARDA_MAX_TIMERS > 0
+    timerClear_();      // Outstanding handles become stale
+#endif
+#if ARDA_MAX_GROUPS > 0
+    groupClear_();      // Memberships referred to the deleted tasks
+#endif
+#if ARDA_MAX_DEPENDENCIES > 0
+    depClear_();        // So did the edges
+#endif
+#ifdef ARDA_COROUTINES
+    coroClear_();       // Stacks go back to the caller
+#endif
+    deferTail_ = deferHead_;  // Discard queued ISR items (consumer-side write only)
+    deferDropped_ = 0;
     taskCount = 0;
     activeCount = 0;
     startTime = 0;
@@ -877,6 +1341,8 @@ bool Arda::reset(bool preserveCallbacks) {
 #endif
         startFailureCallback = nullptr;
         traceCallback = nullptr;
+        idleCallback = nullptr;
+        deferHandler = nullptr;
     }
 
     // Set final error state based on whether all teardowns ran
@@ -889,6 +1355,30 @@ bool Arda::reset(bool preserveCallbacks) {
     return allTeardownsRan;
 }
 
+#ifdef ARDA_EDF
+bool Arda::setSchedulerPolicy(SchedulerPolicy policy) {
+    if (static_cast<uint8_t>(policy) > static_cast<uint8_t>(SchedulerPolicy::Edf)) {
+        error_ = ArdaError::InvalidValue;
+        return false;
+    }
+    policy_ = policy;
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+SchedulerPolicy Arda::getSchedulerPolicy() const {
+    return policy_;
+}
+#endif
+
+void Arda::setCycleBudgetUs(uint32_t budgetUs) {
+    cycleBudgetUs_ = budgetUs;
+}
+
+uint32_t Arda::getCycleBudgetUs() const {
+    return cycleBudgetUs_;
+}
+
 bool Arda::hasBegun() const {
     return (flags_ & FLAG_BEGUN) != 0;
 }
@@ -897,30 +1387,37 @@ bool Arda::hasBegun() const {
 // Task creation and deletion
 // =============================================================================
 
-// Common task field initialization (called after slot allocation and name setup)
-int8_t Arda::initTaskFields_(int8_t id, TaskCallback setup, TaskCallback loop,
-                              uint32_t intervalMs, TaskCallback teardown, bool autoStart) {
-    tasks[id].setup = setup;
-    tasks[id].loop = loop;
-    tasks[id].teardown = teardown;
+// Common task field initialization (called after slot allocation, name and callback setup)
+int8_t Arda::initTaskFields_(int8_t id, uint32_t intervalMs, bool autoStart) {
+#ifdef ARDA_TASK_CONTEXT
+    tasks[id].context = nullptr;
+#endif
 #ifdef ARDA_TASK_RECOVERY
     tasks[id].recover = nullptr;
 #endif
     tasks[id].interval = intervalMs;
     tasks[id].lastRun = 0;
     tasks[id].runCount = 0;    // Union member; nextFree shares this memory
+    tasks[id].notify = 0;      // Not event mode, nothing pending
+    tasks[id].mode = 0;        // TaskTiming::FixedDelay
+#ifdef ARDA_PROTOTHREADS
+    tasks[id].ptInterval = 0;
+    tasks[id].resume = 0;
+#endif
 #ifdef ARDA_TASK_RECOVERY
     tasks[id].timeout = 0;
 #endif
+#ifdef ARDA_EDF
+    tasks[id].deadline = 0;
+#endif
 #ifndef ARDA_NO_PRIORITY
     tasks[id].flags = ARDA_DEFAULT_PRIORITY << ARDA_TASK_PRIORITY_SHIFT;
 #else
-    tasks[id].flags = 0;       // state=Stopped, ranThisCycle=false, inYield=false
+    tasks[id].flags = 0;       // state=Stopped, autoStart=false, inYield=false
 #endif
     // Before begin(): use bit 2 to remember autoStart setting
-    // After begin(): this bit becomes ranThisCycle (reset each cycle anyway)
     if (!(flags_ & FLAG_BEGUN) && autoStart) {
-        tasks[id].flags |= ARDA_TASK_RAN_BIT;  // Reuse as "shouldAutoStart"
+        tasks[id].flags |= ARDA_TASK_AUTOSTART_BIT;
     }
 
     activeCount++;
@@ -941,18 +1438,56 @@ int8_t Arda::initTaskFields_(int8_t id, TaskCallback setup, TaskCallback loop,
     return id;
 }
 
+#ifndef ARDA_NO_NAMES
+// Validate the name of a new task. Sets error and returns false if it is null,
+// empty, too long (no silent truncation) or already taken (findTaskByName()
+// must stay unambiguous).
+bool Arda::checkNewName_(const char* name) {
+    if (name == nullptr) {
+        error_ = ArdaError::NullName;
+        return false;
+    }
+    if (ARDA_NAME_BYTE(name) == '\0') {
+        error_ = ArdaError::EmptyName;
+        return false;
+    }
+    if (ARDA_NAME_LEN(name) >= ARDA_MAX_NAME_LEN) {
+        error_ = ArdaError::NameTooLong;
+        return false;
+    }
+#ifdef ARDA_FLASH_NAMES
+    if (findTaskByStoredName_(name) != -1) {
+#else
+    if (findTaskByName(name) != -1) {
+#endif
+        error_ = ArdaError::DuplicateName;
+        return false;
+    }
+    return true;
+}
+#endif
+
+#ifndef ARDA_TABLE_TASKS
 #ifdef ARDA_NO_NAMES
 
 // Nameless createTask - primary implementation when ARDA_NO_NAMES is defined
 int8_t Arda::createTask(TaskCallback setup, TaskCallback loop,
                         uint32_t intervalMs, TaskCallback teardown, bool autoStart) {
+    if (intervalMs > ARDA_MAX_INTERVAL) {
+        error_ = ArdaError::InvalidValue;
+        return -1;
+    }
+
     int8_t id = allocateSlot();
     if (id == -1) {
         error_ = ArdaError::MaxTasks;
         return -1;
     }
     clearDeleted(tasks[id]);
-    return initTaskFields_(id, setup, loop, intervalMs, teardown, autoStart);
+    tasks[id].setup = setup;
+    tasks[id].loop = loop;
+    tasks[id].teardown = teardown;
+    return initTaskFields_(id, intervalMs, autoStart);
 }
 
 // Backward compatibility overload - accepts name parameter but ignores it
@@ -965,27 +1500,10 @@ int8_t Arda::createTask(const char* name, TaskCallback setup, TaskCallback loop,
 #else  // !ARDA_NO_NAMES
 
 int8_t Arda::createTask(const char* name, TaskCallback setup, TaskCallback loop, uint32_t intervalMs, TaskCallback teardown, bool autoStart) {
-    // Name is required
-    if (name == nullptr) {
-        error_ = ArdaError::NullName;
-        return -1;
-    }
+    if (!checkNewName_(name)) return -1;
 
-    // Name must be non-empty
-    if (name[0] == '\0') {
-        error_ = ArdaError::EmptyName;
-        return -1;
-    }
-
-    // Reject names that are too long (no silent truncation)
-    if (strlen(name) >= ARDA_MAX_NAME_LEN) {
-        error_ = ArdaError::NameTooLong;
-        return -1;
-    }
-
-    // Reject duplicate names to avoid ambiguity in findTaskByName()
-    if (findTaskByName(name) != -1) {
-        error_ = ArdaError::DuplicateName;
+    if (intervalMs > ARDA_MAX_INTERVAL) {
+        error_ = ArdaError::InvalidValue;
         return -1;
     }
 
@@ -995,11 +1513,22 @@ int8_t Arda::createTask(const char* name, TaskCallback setup, TaskCallback loop,
         return -1;
     }
 
+#ifdef ARDA_FLASH_NAMES
+    tasks[id].name = name;  // Borrowed; the deleted marker lives in the state bits
+    clearDeleted(tasks[id]);
+#else
     // Copy name (length already validated above, but use strncpy for defense in depth)
     strncpy(tasks[id].name, name, ARDA_MAX_NAME_LEN - 1);
     tasks[id].name[ARDA_MAX_NAME_LEN - 1] = '\0';
+#endif
+#ifdef ARDA_NAME_INDEX
+    nameIndexInsert_(id);
+#endif
 
-    return initTaskFields_(id, setup, loop, intervalMs, teardown, autoStart);
+    tasks[id].setup = setup;
+    tasks[id].loop = loop;
+    tasks[id].teardown = teardown;
+    return initTaskFields_(id, intervalMs, autoStart);
 }
 
 #endif  // ARDA_NO_NAMES
@@ -1017,42 +1546,285 @@ int8_t Arda::createTask(const char* name, TaskCallback setup, TaskCallback loop,
     }
     // Create task without auto-start so we can set priority first
     int8_t id = createTask(name, setup, loop, intervalMs, teardown, false);
+    if (id < 0) return -1;
+    updatePriority(tasks[id], rawPriority);
+    return autoStartCreated_(id, autoStart);
+}
+#endif
+
+#if defined(ARDA_TASK_RECOVERY) && !defined(ARDA_NO_PRIORITY)
+int8_t Arda::createTask(const char* name, TaskCallback setup, TaskCallback loop,
+                        uint32_t intervalMs, TaskCallback teardown, bool autoStart,
+                        TaskPriority priority, uint32_t timeoutMs, TaskCallback recover) {
+    // Call the priority-based createTask first
+    int8_t id = createTask(name, setup, loop, intervalMs, teardown, autoStart, priority);
     if (id >= 0) {
-        updatePriority(tasks[id], rawPriority);
-        // Handle auto-start: if begin() called, start now; otherwise set bit for begin()
-        if (autoStart) {
-            if (flags_ & FLAG_BEGUN) {
-                if (startTask(id) != StartResult::Success) {
-                    // Auto-start failed - delete the task and return -1.
-                    // Error is already set by startTask(). Use autoStart=false to handle failures manually.
-                    ArdaError savedError = error_;
-                    deleteTask(id);
-                    error_ = savedError;
-                    return -1;
-                }
-            } else {
-                // begin() not called yet - set autoStart bit for begin() to pick up
-                tasks[id].flags |= ARDA_TASK_RAN_BIT;
-            }
+        tasks[id].timeout = timeoutMs;
+        tasks[id].recover = recover;
+    }
+    return id;
+}
+#endif
+
+int8_t Arda::createTaskMicros(const char* name, TaskCallback setup, TaskCallback loop,
+                              uint32_t intervalUs, TaskCallback teardown, bool autoStart) {
+    // Create task without auto-start so the unit is set before its first lastRun
+    int8_t id = createTask(name, setup, loop, intervalUs, teardown, false);
+    if (id < 0) return -1;
+    tasks[id].flags |= ARDA_TASK_MICROS_BIT;
+    return autoStartCreated_(id, autoStart);
+}
+
+int8_t Arda::createEventTask(const char* name, TaskCallback setup, TaskCallback loop,
+                             uint32_t intervalMs, TaskCallback teardown, bool autoStart) {
+    int8_t id = createTask(name, setup, loop, intervalMs, teardown, false);
+    if (id < 0) return -1;
+    tasks[id].notify = ARDA_NOTIFY_EVENT_BIT;
+    return autoStartCreated_(id, autoStart);
+}
+#endif  // ARDA_TABLE_TASKS
+
+// Shared tail of the createTask variants that configure a task before starting it:
+// start now if begin() was called, otherwise mark it for begin() to pick up.
+int8_t Arda::autoStartCreated_(int8_t id, bool autoStart) {
+    if (!autoStart) return id;
+    if (flags_ & FLAG_BEGUN) {
+        if (startTask(id) != StartResult::Success) {
+            // Auto-start failed - delete the task and return -1.
+            // Error is already set by startTask(). Use autoStart=false to handle failures manually.
+            ArdaError savedError = error_;
+            deleteTask(id);
+            error_ = savedError;
+            return -1;
         }
+    } else {
+        tasks[id].flags |= ARDA_TASK_AUTOSTART_BIT;  // begin() not called yet - autoStart bit
+    }
+    return id;
+}
+
+#ifdef ARDA_TASK_CONTEXT
+int8_t Arda::createTask(const char* name, TaskContextCallback setup, TaskContextCallback loop,
+                        void* context, uint32_t intervalMs,
+                        TaskContextCallback teardown, bool autoStart) {
+    // Create without auto-start so setup() already receives the context
+    int8_t id = createTask(name, reinterpret_cast<TaskCallback>(setup),
+                           reinterpret_cast<TaskCallback>(loop), intervalMs,
+                           reinterpret_cast<TaskCallback>(teardown), false);
+    if (id < 0) return -1;
+    tasks[id].context = context;
+    tasks[id].mode |= ARDA_MODE_CONTEXT_BIT;
+    return autoStartCreated_(id, autoStart);
+}
+
+#ifdef ARDA_NO_NAMES
+int8_t Arda::createTask(TaskContextCallback setup, TaskContextCallback loop,
+                        void* context, uint32_t intervalMs,
+                        TaskContextCallback teardown, bool autoStart) {
+    return createTask(nullptr, setup, loop, context, intervalMs, teardown, autoStart);
+}
+#endif
+
+void* Arda::getTaskContext(int8_t taskId) const {
+    if (!isValidTask(taskId)) return nullptr;
+    return tasks[taskId].context;
+}
+#endif
+
+#ifdef ARDA_CHILD_SCHEDULERS
+void Arda::childBegin_(void* child) {
+    Arda* c = static_cast<Arda*>(child);
+    if (c->hasBegun()) return;
+    if (c->parent_) c->clock_ = c->parent_->clock_;  // One time base for the whole tree
+    c->begin();
+}
+
+// One child cycle, bounded by the tighter of the mount budget and what is left
+// of the parent's own budget. The mount budget is restored afterwards.
+void Arda::childRun_(void* child) {
+    Arda* c = static_cast<Arda*>(child);
+    uint32_t own = c->cycleBudgetUs_;
+    uint32_t left = c->parent_ ? c->parent_->budgetLeftUs_() : UINT32_MAX;
+    if (left != UINT32_MAX && (own == 0 || left < own)) c->cycleBudgetUs_ = left;
+    c->run();
+    c->cycleBudgetUs_ = own;
+}
+
+uint32_t Arda::budgetLeftUs_() const {
+    if (cycleBudgetUs_ == 0) return UINT32_MAX;
+    uint32_t used = ardaMicrosClock() - budgetStartUs_;
+    return (used < cycleBudgetUs_) ? cycleBudgetUs_ - used : 1;  // 1: one task, then stop
+}
+
+int8_t Arda::mountScheduler(const char* name, Arda& child, uint32_t intervalMs,
+                            uint32_t budgetUs, bool autoStart) {
+    if (&child == this) {
+        error_ = ArdaError::InvalidValue;
+        return -1;
+    }
+    if (child.parent_ != nullptr) {
+        error_ = ArdaError::WrongState;  // Already mounted, here or on another scheduler
+        return -1;
+    }
+    if (child.hasBegun() && child.clock_ != clock_) {
+        error_ = ArdaError::AlreadyBegun;  // Its timestamps are on another time base
+        return -1;
+    }
+    int8_t id = createTask(name, childBegin_, childRun_, &child, intervalMs, nullptr, false);
+    if (id < 0) return -1;
+    uint32_t oldBudget = child.getCycleBudgetUs();
+    child.setCycleBudgetUs(budgetUs);
+    child.parent_ = this;  // Before autoStart: childBegin_() takes the clock from it
+    if (!child.hasBegun()) child.clock_ = clock_;
+    if (autoStartCreated_(id, autoStart) < 0) {
+        child.setCycleBudgetUs(oldBudget);  // deleteTask() already cleared parent_
+        return -1;
+    }
+    return id;
+}
+
+#ifdef ARDA_NO_NAMES
+int8_t Arda::mountScheduler(Arda& child, uint32_t intervalMs, uint32_t budgetUs, bool autoStart) {
+    return mountScheduler(nullptr, child, intervalMs, budgetUs, autoStart);
+}
+#endif
+
+Arda* Arda::getChildScheduler(int8_t taskId) const {
+    if (!isValidTask(taskId)) return nullptr;
+    if (!(tasks[taskId].mode & ARDA_MODE_CONTEXT_BIT)) return nullptr;
+    if (taskLoop(tasks[taskId]) != reinterpret_cast<TaskCallback>(childRun_)) return nullptr;
+    return static_cast<Arda*>(tasks[taskId].context);
+}
+#endif
+
+#ifdef ARDA_COROUTINES
+int8_t Arda::createCoroutine(const char* name, TaskCallback body, void* stack, size_t stackSize,
+                             uint32_t intervalMs, TaskCallback teardown, bool autoStart) {
+    if (body == nullptr || stack == nullptr || stackSize < ARDA_MIN_CORO_STACK) {
+        error_ = ArdaError::InvalidValue;
+        return -1;
+    }
+    int8_t slot = coroSlot_(-1);
+    if (slot < 0) {
+        error_ = ArdaError::MaxTasks;  // Out of coroutine slots
+        return -1;
+    }
+    int8_t id = createTask(name, nullptr, body, intervalMs, teardown, false);
+    if (id < 0) return -1;
+    tasks[id].mode |= ARDA_MODE_CORO_BIT;
+    Coroutine_& c = coro_[slot];
+    c.stack = stack;
+    c.stackSize = stackSize;
+    c.taskId = id;
+    c.active = false;
+    c.sleepPending = false;
+    c.sleeping = false;
+    return autoStartCreated_(id, autoStart);
+}
+#endif
+
+#ifdef ARDA_NO_NAMES
+int8_t Arda::createTaskMicros(TaskCallback setup, TaskCallback loop,
+                              uint32_t intervalUs, TaskCallback teardown, bool autoStart) {
+    return createTaskMicros(nullptr, setup, loop, intervalUs, teardown, autoStart);
+}
+#ifdef ARDA_COROUTINES
+int8_t Arda::createCoroutine(TaskCallback body, void* stack, size_t stackSize,
+                             uint32_t intervalMs, TaskCallback teardown, bool autoStart) {
+    return createCoroutine(nullptr, body, stack, stackSize, intervalMs, teardown, autoStart);
+}
+#endif
+
+int8_t Arda::createEventTask(TaskCallback setup, TaskCallback loop,
+                             uint32_t intervalMs, TaskCallback teardown, bool autoStart) {
+    return createEventTask(nullptr, setup, loop, intervalMs, teardown, autoStart);
+}
+#endif
+
+#ifdef ARDA_TABLE_TASKS
+// Table-backed task: the slot points at 'def', so the name and callbacks are never
+// copied to RAM. Interval and priority stay mutable and start from the row.
+int8_t Arda::createTableTask_(const ArdaTaskDef* def) {
+    if (!checkNewName_(def->name)) return -1;
+#ifdef __AVR__
+    uint32_t intervalMs = pgm_read_dword(&def->interval);  // Table lives in PROGMEM
+    uint8_t priority = pgm_read_byte(&def->priority);
+#else
+    uint32_t intervalMs = def->interval;
+    uint8_t priority = def->priority;
+#endif
+    if (intervalMs > ARDA_MAX_INTERVAL) {
+        error_ = ArdaError::InvalidValue;
+        return -1;
+    }
+#ifndef ARDA_NO_PRIORITY
+    if (priority > static_cast<uint8_t>(TaskPriority::Highest)) {
+        error_ = ArdaError::InvalidValue;
+        return -1;
+    }
+#else
+    (void)priority;
+#endif
+
+    int8_t id = allocateSlot();
+    if (id == -1) {
+        error_ = ArdaError::MaxTasks;
+        return -1;
     }
-    return id;
+    tasks[id].def = def;
+    clearDeleted(tasks[id]);
+#ifdef ARDA_NAME_INDEX
+    nameIndexInsert_(id);
+#endif
+    initTaskFields_(id, intervalMs, false);
+#ifndef ARDA_NO_PRIORITY
+    updatePriority(tasks[id], priority);
+#endif
+    return autoStartCreated_(id, true);
 }
 #endif
 
-#if defined(ARDA_TASK_RECOVERY) && !defined(ARDA_NO_PRIORITY)
-int8_t Arda::createTask(const char* name, TaskCallback setup, TaskCallback loop,
-                        uint32_t intervalMs, TaskCallback teardown, bool autoStart,
-                        TaskPriority priority, uint32_t timeoutMs, TaskCallback recover) {
-    // Call the priority-based createTask first
-    int8_t id = createTask(name, setup, loop, intervalMs, teardown, autoStart, priority);
-    if (id >= 0) {
-        tasks[id].timeout = timeoutMs;
-        tasks[id].recover = recover;
+int8_t Arda::createTasks(const ArdaTaskDef* table, int8_t count, int8_t* failedIndex) {
+    if (failedIndex) *failedIndex = -1;
+    if (table == nullptr || count <= 0) {
+        error_ = ArdaError::Ok;  // No-op is successful
+        return 0;
     }
-    return id;
-}
+    int8_t created = 0;
+    ArdaError firstError = ArdaError::Ok;
+    for (int8_t i = 0; i < count; i++) {
+#ifdef ARDA_TABLE_TASKS
+        int8_t id = createTableTask_(&table[i]);
+#else
+        ArdaTaskDef def;
+#ifdef __AVR__
+        memcpy_P(&def, &table[i], sizeof(def));  // Table lives in PROGMEM
+#else
+        def = table[i];
+#endif
+#ifdef ARDA_FLASH_NAMES
+        const char* name = table[i].name;  // Borrow the name from the table itself
+#else
+        def.name[ARDA_MAX_NAME_LEN - 1] = '\0';  // Defense in depth for hand-built tables
+        const char* name = def.name;
+#endif
+#ifndef ARDA_NO_PRIORITY
+        int8_t id = createTask(name, def.setup, def.loop, def.interval, def.teardown,
+                               true, static_cast<TaskPriority>(def.priority));
+#else
+        int8_t id = createTask(name, def.setup, def.loop, def.interval, def.teardown);
 #endif
+#endif  // ARDA_TABLE_TASKS
+        if (id >= 0) {
+            created++;
+        } else if (firstError == ArdaError::Ok) {
+            firstError = error_;  // Capture first failure
+            if (failedIndex) *failedIndex = i;
+        }
+    }
+    error_ = firstError;
+    return created;
+}
 
 bool Arda::deleteTask(int8_t taskId) {
     if (!isValidTask(taskId)) {
@@ -1084,15 +1856,29 @@ bool Arda::deleteTask(int8_t taskId) {
     // Note: This invalidates the task before the trace event, so callbacks cannot
     // query task info (getTaskName, getTaskState return nullptr/Invalid). The task ID
     // is still valid for identifying which task was deleted.
+#ifdef ARDA_NAME_INDEX
+    nameIndexRemove_(taskId);  // Needs the name, which markDeleted() may clear
+#endif
+#ifdef ARDA_CHILD_SCHEDULERS
+    Arda* child = getChildScheduler(taskId);
+    if (child) child->parent_ = nullptr;  // Unmounted: free to mount elsewhere
+#endif
     markDeleted(tasks[taskId]);
 
     // Emit trace event (task already invalidated - callbacks get ID only)
     emitTrace(taskId, TraceEvent::TaskDeleted);
 
     // Clear task data and add to free list
+#ifdef ARDA_TABLE_TASKS
+    tasks[taskId].def = nullptr;
+#else
     tasks[taskId].setup = nullptr;
     tasks[taskId].loop = nullptr;
     tasks[taskId].teardown = nullptr;
+#endif
+#ifdef ARDA_TASK_CONTEXT
+    tasks[taskId].context = nullptr;
+#endif
 #ifdef ARDA_TASK_RECOVERY
     tasks[taskId].recover = nullptr;
 #endif
@@ -1102,11 +1888,34 @@ bool Arda::deleteTask(int8_t taskId) {
     tasks[taskId].timeout = 0;
 #endif
     // Reset flag bits; markDeleted already set the deleted state
-#ifdef ARDA_NO_NAMES
+#ifdef ARDA_TASK_DELETED_STATE
     tasks[taskId].flags = ARDA_TASK_DELETED_STATE;  // state=deleted, clear other bits
 #else
     // name[0]='\0' already marks as deleted
-    tasks[taskId].flags = 0;  // state=Stopped, ranThisCycle=false, inYield=false
+    tasks[taskId].flags = 0;  // state=Stopped, autoStart=false, inYield=false
+#endif
+
+#ifdef ARDA_COROUTINES
+    int8_t coroSlot = coroSlot_(taskId);
+    if (coroSlot >= 0) coro_[coroSlot].taskId = -1;  // Stack belongs to the caller again
+#endif
+#if ARDA_MAX_GROUPS > 0
+    // Leave every group, so a reused slot starts ungrouped
+    for (uint8_t g = 0; g < ARDA_MAX_GROUPS; g++) {
+        groupMembers_[g][taskId >> 3] &= (uint8_t)~(1 << (taskId & 7));
+    }
+    heldMask_[taskId >> 3] &= (uint8_t)~(1 << (taskId & 7));
+#endif
+#if ARDA_MAX_DEPENDENCIES > 0
+    // Drop the task's edges, so a reused slot starts unordered
+    for (int8_t k = 0; k < ARDA_MAX_DEPENDENCIES; k++) {
+        if (deps_[k].before == taskId || deps_[k].after == taskId) {
+            deps_[k].before = -1;
+            deps_[k].after = -1;
+        }
+    }
+    depRefresh_();
+    triggeredMask_[taskId >> 3] &= (uint8_t)~(1 << (taskId & 7));
 #endif
 
     // Add slot to free list (O(1) operation) - sets nextFree in union
@@ -1178,11 +1987,12 @@ StartResult Arda::startTask(int8_t taskId, bool runImmediately) {
     // loop should validate before createTask(). See test_null_loop_function_task.
 
     updateState(tasks[taskId], TaskState::Running);
+    readyGen_++;  // Task may now be eligible - invalidate in-flight ready masks
     if (runImmediately && tasks[taskId].interval > 0) {
         // Set lastRun far enough in the past to trigger on next run() cycle.
-        tasks[taskId].lastRun = millis() - tasks[taskId].interval;
+        tasks[taskId].lastRun = taskClock_(taskId) - tasks[taskId].interval;
     } else {
-        tasks[taskId].lastRun = millis();  // Wait one full interval before first run
+        tasks[taskId].lastRun = taskClock_(taskId);  // Wait one full interval before first run
     }
     tasks[taskId].runCount = 0;
     // runImmediately controls same-cycle execution for ALL tasks (including zero-interval).
@@ -1190,23 +2000,25 @@ StartResult Arda::startTask(int8_t taskId, bool runImmediately) {
     // IMPORTANT: If we're inside a run() cycle, always set ranThisCycle=true to prevent
     // a task from executing multiple times per cycle (e.g., task stops and restarts itself).
     if (flags_ & FLAG_IN_RUN) {
-        updateRanThisCycle(tasks[taskId], true);  // Already had its chance this cycle
+        updateRanThisCycle_(taskId, true);  // Already had its chance this cycle
     } else {
-        updateRanThisCycle(tasks[taskId], !runImmediately);
+        updateRanThisCycle_(taskId, !runImmediately);
     }
 #ifdef ARDA_YIELD
     updateInYield(tasks[taskId], false);  // Clear any stale yield state from previous run
 #endif
+    schedUpdate_(taskId);
 
     // Run setup function if provided
-    if (tasks[taskId].setup != nullptr) {
+    if (taskSetup(tasks[taskId]) != nullptr) {
         // Guard against excessive callback nesting (prevents stack overflow)
         if (callbackDepth >= ARDA_MAX_CALLBACK_DEPTH) {
             // Revert all state changes for clean failure semantics
             updateState(tasks[taskId], TaskState::Stopped);
             tasks[taskId].runCount = 0;
             tasks[taskId].lastRun = 0;
-            updateRanThisCycle(tasks[taskId], false);
+            updateRanThisCycle_(taskId, false);
+            schedUpdate_(taskId);
             error_ = ArdaError::CallbackDepth;
             return StartResult::Failed;
         }
@@ -1214,7 +2026,7 @@ StartResult Arda::startTask(int8_t taskId, bool runImmediately) {
         int8_t prevTask = currentTask;
         currentTask = taskId;
         callbackDepth++;
-        tasks[taskId].setup();
+        callTask_(taskId, taskSetup(tasks[taskId]));
         callbackDepth--;
         currentTask = prevTask;
 
@@ -1241,6 +2053,7 @@ bool Arda::pauseTask(int8_t taskId) {
     }
 
     updateState(tasks[taskId], TaskState::Paused);
+    schedUpdate_(taskId);
     emitTrace(taskId, TraceEvent::TaskPaused);
     error_ = ArdaError::Ok;
     return true;
@@ -1257,11 +2070,46 @@ bool Arda::resumeTask(int8_t taskId) {
     }
 
     updateState(tasks[taskId], TaskState::Running);
+    schedUpdate_(taskId);
+    readyGen_++;  // Resumed task may be eligible this cycle
     emitTrace(taskId, TraceEvent::TaskResumed);
     error_ = ArdaError::Ok;
     return true;
 }
 
+bool Arda::notifyTask(int8_t taskId, uint8_t bits) {
+    if (!isValidTask(taskId)) {
+        error_ = ArdaError::InvalidId;
+        return false;
+    }
+    if (bits == 0 || (bits & ~ARDA_NOTIFY_MASK)) {
+        error_ = ArdaError::InvalidValue;
+        return false;
+    }
+
+    notifyBits_(taskId, bits);
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+void Arda::notifyBits_(int8_t id, uint8_t bits) {
+    tasks[id].notify |= bits;
+    if (tasks[id].notify & ARDA_NOTIFY_EVENT_BIT) {
+        schedUpdate_(id);
+        readyGen_++;  // Woken task may be eligible this cycle
+    }
+}
+
+uint8_t Arda::takeNotification() {
+    if (currentTask < 0) return 0;
+    uint8_t bits = tasks[currentTask].notify & ARDA_NOTIFY_MASK;
+    tasks[currentTask].notify &= ~ARDA_NOTIFY_MASK;
+    if (bits && (tasks[currentTask].notify & ARDA_NOTIFY_EVENT_BIT)) {
+        schedUpdate_(currentTask);  // Nothing pending - no longer ready
+    }
+    return bits;
+}
+
 StopResult Arda::stopTask(int8_t taskId) {
     if (!isValidTask(taskId)) {
         error_ = ArdaError::InvalidId;
@@ -1284,9 +2132,17 @@ StopResult Arda::stopTask(int8_t taskId) {
 
     // Set state BEFORE teardown so teardown can query correct state
     updateState(tasks[taskId], TaskState::Stopped);
+#ifdef ARDA_COROUTINES
+    coroRewind_(taskId);  // Next start runs the body from the top
+#endif
+#ifdef ARDA_PROTOTHREADS
+    ptWake_(taskId);
+    tasks[taskId].resume = 0;  // Next start runs the protothread from the top
+#endif
+    schedUpdate_(taskId);
 
     // Call teardown function if provided
-    if (tasks[taskId].teardown != nullptr) {
+    if (taskTeardown(tasks[taskId]) != nullptr) {
         // Guard against excessive callback nesting (prevents stack overflow)
         // Task state is STOPPED, return TeardownSkipped to indicate teardown was not run.
         if (callbackDepth >= ARDA_MAX_CALLBACK_DEPTH) {
@@ -1298,7 +2154,7 @@ StopResult Arda::stopTask(int8_t taskId) {
         int8_t prevTask = currentTask;
         currentTask = taskId;
         callbackDepth++;
-        tasks[taskId].teardown();
+        callTask_(taskId, taskTeardown(tasks[taskId]));
         callbackDepth--;
         currentTask = prevTask;
 
@@ -1320,16 +2176,128 @@ StopResult Arda::stopTask(int8_t taskId) {
 // =============================================================================
 
 bool Arda::setTaskInterval(int8_t taskId, uint32_t intervalMs, bool resetTiming) {
+    return setIntervalInternal_(taskId, intervalMs, false, resetTiming);
+}
+
+bool Arda::setTaskIntervalMicros(int8_t taskId, uint32_t intervalUs, bool resetTiming) {
+    return setIntervalInternal_(taskId, intervalUs, true, resetTiming);
+}
+
+#ifdef ARDA_EDF
+bool Arda::setTaskDeadline(int8_t taskId, uint32_t relDeadline) {
+    if (!isValidTask(taskId)) {
+        error_ = ArdaError::InvalidId;
+        return false;
+    }
+    if (relDeadline > ARDA_MAX_INTERVAL) {
+        error_ = ArdaError::InvalidValue;
+        return false;
+    }
+    tasks[taskId].deadline = relDeadline;
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+uint32_t Arda::getTaskDeadline(int8_t taskId) const {
+    if (!isValidTask(taskId)) {
+        return 0;
+    }
+    return tasks[taskId].deadline;
+}
+#endif
+
+bool Arda::setTaskTiming(int8_t taskId, TaskTiming timing) {
+    if (!isValidTask(taskId)) {
+        error_ = ArdaError::InvalidId;
+        return false;
+    }
+    uint8_t raw = static_cast<uint8_t>(timing);
+    if (raw > static_cast<uint8_t>(TaskTiming::CatchUp)) {
+        error_ = ArdaError::InvalidValue;
+        return false;
+    }
+    tasks[taskId].mode = (uint8_t)((tasks[taskId].mode & ~ARDA_MODE_TIMING_MASK) | raw);
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+bool Arda::setTaskEventMode(int8_t taskId, bool enabled) {
+    if (!isValidTask(taskId)) {
+        error_ = ArdaError::InvalidId;
+        return false;
+    }
+    if (enabled) {
+        tasks[taskId].notify |= ARDA_NOTIFY_EVENT_BIT;
+    } else {
+        tasks[taskId].notify &= ~ARDA_NOTIFY_EVENT_BIT;
+    }
+    schedUpdate_(taskId);
+    readyGen_++;  // Leaving event mode can make an interval-0 task ready
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+bool Arda::setIntervalInternal_(int8_t taskId, uint32_t interval, bool useMicros, bool resetTiming) {
     if (!isValidTask(taskId)) {
         error_ = ArdaError::InvalidId;
         return false;
     }
 
-    tasks[taskId].interval = intervalMs;
+    if (interval > ARDA_MAX_INTERVAL) {
+        error_ = ArdaError::InvalidValue;
+        return false;
+    }
+
+    // While ARDA_SLEEP or a coroutine sleep() borrows 'interval' for the sleep
+    // span, the task's own interval is parked here and restored on wake
+    uint32_t* ownInterval = nullptr;
+#ifdef ARDA_PROTOTHREADS
+    if (tasks[taskId].mode & ARDA_MODE_PT_SLEEP_BIT) ownInterval = &tasks[taskId].ptInterval;
+#endif
+#ifdef ARDA_COROUTINES
+    int8_t k = coroSlot_(taskId);
+    if (k >= 0 && coro_[k].sleeping) ownInterval = &coro_[k].savedInterval;
+#endif
+
+    bool wasMicros = (tasks[taskId].flags & ARDA_TASK_MICROS_BIT) != 0;
+    if (useMicros != wasMicros) {
+        // Carry the time since lastRun over to the new unit
+        uint32_t elapsed = taskClock_(taskId) - tasks[taskId].lastRun;
+        if (useMicros) {
+            elapsed = (elapsed > UINT32_MAX / 1000) ? UINT32_MAX : elapsed * 1000;
+            tasks[taskId].flags |= ARDA_TASK_MICROS_BIT;
+        } else {
+            elapsed /= 1000;
+            tasks[taskId].flags &= ~ARDA_TASK_MICROS_BIT;
+        }
+        tasks[taskId].lastRun = taskClock_(taskId) - elapsed;
+        if (ownInterval) {
+            // The pending sleep span follows the task into the new unit
+            uint32_t span = tasks[taskId].interval;
+            if (useMicros) {
+                span = (span > ARDA_MAX_INTERVAL / 1000) ? ARDA_MAX_INTERVAL : span * 1000;
+            } else {
+                span /= 1000;
+            }
+            tasks[taskId].interval = span;
+        }
+    }
+
+    if (ownInterval) {
+        // Mid-sleep: change the interval restored on wake and leave the pending
+        // sleep and its lastRun alone
+        *ownInterval = interval;
+        schedUpdate_(taskId);
+        error_ = ArdaError::Ok;
+        return true;
+    }
+    tasks[taskId].interval = interval;
     if (resetTiming) {
         // Reset lastRun to ensure consistent timing from when interval was changed.
-        tasks[taskId].lastRun = millis();
+        tasks[taskId].lastRun = taskClock_(taskId);
     }
+    schedUpdate_(taskId);
+    readyGen_++;  // A shorter interval can make the task due this cycle
     // If resetTiming=false, keep existing lastRun so next run is based on
     // previous timing + new interval (useful for extending/shortening current wait)
     error_ = ArdaError::Ok;
@@ -1448,6 +2416,8 @@ bool Arda::setTaskPriority(int8_t taskId, TaskPriority priority) {
         return false;
     }
     updatePriority(tasks[taskId], rawPriority);
+    schedUpdate_(taskId);
+    readyGen_++;  // Task moves to a different ready level
     error_ = ArdaError::Ok;
     return true;
 }
@@ -1456,9 +2426,17 @@ TaskPriority Arda::getTaskPriority(int8_t taskId) const {
     if (!isValidTask(taskId)) return TaskPriority::Lowest;
     return static_cast<TaskPriority>(extractPriority(tasks[taskId]));
 }
+
+void Arda::setPriorityAging(uint16_t stepMs) {
+    agingStepMs_ = stepMs;
+}
+
+uint16_t Arda::getPriorityAging() const {
+    return agingStepMs_;
+}
 #endif
 
-#ifdef ARDA_NO_NAMES
+#if defined(ARDA_NO_NAMES) || defined(ARDA_TABLE_TASKS)
 bool Arda::renameTask(int8_t taskId, const char* newName) {
     (void)taskId;
     (void)newName;
@@ -1477,25 +2455,39 @@ bool Arda::renameTask(int8_t taskId, const char* newName) {
         error_ = ArdaError::NullName;
         return false;
     }
-    if (newName[0] == '\0') {
+    if (ARDA_NAME_BYTE(newName) == '\0') {
         error_ = ArdaError::EmptyName;
         return false;
     }
-    if (strlen(newName) >= ARDA_MAX_NAME_LEN) {
+    if (ARDA_NAME_LEN(newName) >= ARDA_MAX_NAME_LEN) {
         error_ = ArdaError::NameTooLong;
         return false;
     }
 
     // Check for duplicate (but allow renaming to same name)
+#ifdef ARDA_FLASH_NAMES
+    int8_t existing = findTaskByStoredName_(newName);
+#else
     int8_t existing = findTaskByName(newName);
+#endif
     if (existing != -1 && existing != taskId) {
         error_ = ArdaError::DuplicateName;
         return false;
     }
 
+#ifdef ARDA_NAME_INDEX
+    nameIndexRemove_(taskId);
+#endif
+#ifdef ARDA_FLASH_NAMES
+    tasks[taskId].name = newName;  // Borrowed, like createTask()
+#else
     // Copy name (length already validated above, but use strncpy for defense in depth)
     strncpy(tasks[taskId].name, newName, ARDA_MAX_NAME_LEN - 1);
     tasks[taskId].name[ARDA_MAX_NAME_LEN - 1] = '\0';
+#endif
+#ifdef ARDA_NAME_INDEX
+    nameIndexInsert_(taskId);
+#endif
     error_ = ArdaError::Ok;
     return true;
 }
@@ -1704,38 +2696,326 @@ int8_t Arda::pauseAllTasks() {
     } else {
         error_ = ArdaError::Ok;
     }
-    return succeeded;
+    return succeeded;
+}
+
+int8_t Arda::resumeAllTasks() {
+    // Snapshot task IDs to protect against callbacks modifying the task array
+    int8_t snapshot[ARDA_MAX_TASKS];
+    int8_t snapshotCount = 0;
+    for (int8_t i = 0; i < taskCount; i++) {
+        if (!isDeleted(tasks[i]) && extractState(tasks[i]) == TaskState::Paused) {
+            snapshot[snapshotCount++] = i;
+        }
+    }
+
+    int8_t succeeded = 0;
+    ArdaError firstError = ArdaError::Ok;
+    for (int8_t j = 0; j < snapshotCount; j++) {
+        int8_t i = snapshot[j];
+        if (!isValidTask(i)) continue;  // Task was deleted since snapshot
+        if (extractState(tasks[i]) != TaskState::Paused) continue;  // State changed since snapshot
+        if (resumeTask(i)) {
+            succeeded++;
+        } else if (firstError == ArdaError::Ok) {
+            firstError = error_;
+        }
+    }
+    if (firstError != ArdaError::Ok) {
+        error_ = firstError;
+    } else {
+        error_ = ArdaError::Ok;
+    }
+    return succeeded;
+}
+
+#if ARDA_MAX_GROUPS > 0
+// -----------------------------------------------------------------------------
+// Task groups: one member bitmap per group, plus heldMask_ - the union of the
+// paused groups' members. Pausing or resuming a group rebuilds heldMask_
+// (ARDA_MAX_GROUPS x ceil(ARDA_MAX_TASKS/8) bytes) and re-files only the tasks
+// whose held status changed: held tasks leave the ready structures, so idle
+// run() and msUntilNextDue() never see them, and member state is never touched.
+// -----------------------------------------------------------------------------
+
+bool Arda::isHeld_(int8_t id) const {
+    return (heldMask_[id >> 3] & (1 << (id & 7))) != 0;
+}
+
+void Arda::groupRefresh_() {
+    uint8_t changed[ARDA_TASK_MASK_BYTES];
+    memcpy(changed, heldMask_, sizeof(changed));
+    memset(heldMask_, 0, sizeof(heldMask_));
+    for (uint8_t g = 0; g < ARDA_MAX_GROUPS; g++) {
+        if (!(groupPaused_ & (1 << g))) continue;
+        for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+            heldMask_[b] |= groupMembers_[g][b];
+        }
+    }
+    for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+        carryMask_[b] &= (uint8_t)~heldMask_[b];  // Held tasks are not owed a budget carry-over
+        changed[b] ^= heldMask_[b];
+        while (changed[b]) {
+            uint8_t bit = 0;
+            while (!(changed[b] & (1 << bit))) bit++;
+            changed[b] &= (uint8_t)~(1 << bit);
+            int8_t id = (int8_t)(b * 8 + bit);
+            if (isValidTask(id)) schedUpdate_(id);
+        }
+    }
+}
+
+void Arda::groupClear_() {
+    memset(groupMembers_, 0, sizeof(groupMembers_));
+    memset(heldMask_, 0, sizeof(heldMask_));
+    groupPaused_ = 0;
+}
+
+bool Arda::addToGroup(int8_t taskId, uint8_t group) {
+    if (group >= ARDA_MAX_GROUPS) {
+        error_ = ArdaError::InvalidValue;
+        return false;
+    }
+    if (!isValidTask(taskId)) {
+        error_ = ArdaError::InvalidId;
+        return false;
+    }
+    setMaskBit(groupMembers_[group], taskId);
+    groupRefresh_();
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+bool Arda::removeFromGroup(int8_t taskId, uint8_t group) {
+    if (group >= ARDA_MAX_GROUPS) {
+        error_ = ArdaError::InvalidValue;
+        return false;
+    }
+    if (!isValidTask(taskId)) {
+        error_ = ArdaError::InvalidId;
+        return false;
+    }
+    groupMembers_[group][taskId >> 3] &= (uint8_t)~(1 << (taskId & 7));
+    groupRefresh_();
+    readyGen_++;  // Task may no longer be held
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+bool Arda::isInGroup(int8_t taskId, uint8_t group) const {
+    if (group >= ARDA_MAX_GROUPS || !isValidTask(taskId)) return false;
+    return (groupMembers_[group][taskId >> 3] & (1 << (taskId & 7))) != 0;
+}
+
+bool Arda::pauseGroup(uint8_t group) {
+    if (group >= ARDA_MAX_GROUPS) {
+        error_ = ArdaError::InvalidValue;
+        return false;
+    }
+    groupPaused_ |= (uint8_t)(1 << group);
+    groupRefresh_();
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+bool Arda::resumeGroup(uint8_t group) {
+    if (group >= ARDA_MAX_GROUPS) {
+        error_ = ArdaError::InvalidValue;
+        return false;
+    }
+    groupPaused_ &= (uint8_t)~(1 << group);
+    groupRefresh_();
+    readyGen_++;  // Released members may be eligible this cycle
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+bool Arda::isGroupPaused(uint8_t group) const {
+    return group < ARDA_MAX_GROUPS && (groupPaused_ & (1 << group)) != 0;
+}
+
+bool Arda::isTaskHeld(int8_t taskId) const {
+    return isValidTask(taskId) && isHeld_(taskId);
+}
+
+int8_t Arda::stopGroup(uint8_t group, int8_t* failedId) {
+    if (failedId) *failedId = -1;
+    if (group >= ARDA_MAX_GROUPS) {
+        error_ = ArdaError::InvalidValue;
+        return 0;
+    }
+    // Collect members first: teardown() callbacks may change membership
+    int8_t ids[ARDA_MAX_TASKS];
+    int8_t count = 0;
+    for (int8_t i = 0; i < taskCount; i++) {
+        if (isInGroup(i, group) && extractState(tasks[i]) != TaskState::Stopped) {
+            ids[count++] = i;
+        }
+    }
+    return stopTasks(ids, count, failedId);
+}
+#endif
+
+#if ARDA_MAX_DEPENDENCIES > 0
+// -----------------------------------------------------------------------------
+// Dependencies: a fixed pool of run-after edges. Only tasks in depTasks_ pay for
+// the edge scan at dispatch. A task taken from the ready masks while one of its
+// 'before' tasks is still due this cycle goes back into the masks and the
+// 'before' task runs in its place, so one pass yields a topological order. The
+// graph is kept acyclic by addDependency(), which bounds every redirect chain.
+// -----------------------------------------------------------------------------
+
+void Arda::depRefresh_() {
+    memset(depTasks_, 0, sizeof(depTasks_));
+    for (int8_t k = 0; k < ARDA_MAX_DEPENDENCIES; k++) {
+        if (deps_[k].before < 0) continue;
+        setMaskBit(depTasks_, deps_[k].before);
+        setMaskBit(depTasks_, deps_[k].after);
+    }
+}
+
+void Arda::depClear_() {
+    for (int8_t k = 0; k < ARDA_MAX_DEPENDENCIES; k++) {
+        deps_[k].before = -1;
+        deps_[k].after = -1;
+        deps_[k].onlyIfRan = false;
+    }
+    memset(depTasks_, 0, sizeof(depTasks_));
+    memset(triggeredMask_, 0, sizeof(triggeredMask_));
+}
+
+bool Arda::depReaches_(int8_t from, int8_t to) const {
+    uint8_t seen[ARDA_TASK_MASK_BYTES];
+    int8_t stack[ARDA_MAX_TASKS];
+    int8_t top = 0;
+    memset(seen, 0, sizeof(seen));
+    setMaskBit(seen, from);
+    stack[top++] = from;
+    while (top > 0) {
+        int8_t id = stack[--top];
+        if (id == to) return true;
+        for (int8_t k = 0; k < ARDA_MAX_DEPENDENCIES; k++) {
+            if (deps_[k].before != id) continue;
+            int8_t next = deps_[k].after;
+            if (seen[next >> 3] & (1 << (next & 7))) continue;
+            setMaskBit(seen, next);
+            stack[top++] = next;  // Each task is pushed at most once
+        }
+    }
+    return false;
+}
+
+// A task that is in the ready masks and would actually be dispatched
+bool Arda::depPending_(const uint8_t readyMask[][ARDA_TASK_MASK_BYTES], int8_t id) const {
+    bool queued = false;
+    for (uint8_t p = 0; p < ARDA_READY_LEVELS; p++) {
+        if (readyMask[p][id >> 3] & (1 << (id & 7))) queued = true;
+    }
+    if (!queued || !isValidTask(id)) return false;
+    if (extractState(tasks[id]) != TaskState::Running || taskLoop(tasks[id]) == nullptr) return false;
+#if ARDA_MAX_GROUPS > 0
+    if (isHeld_(id)) return false;
+#endif
+    return !checkRanThisCycle_(id);
+}
+
+// Task to dispatch instead of 'id': its first 'before' task still pending this
+// cycle (followed transitively), 'id' itself, or -1 if an onlyIfRan input of 'id'
+// has not run and is not pending. Every task passed over goes back into the ready
+// masks; 'deferred' receives the lowest such ID (ARDA_MAX_TASKS if none).
+int8_t Arda::depResolve_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], int8_t id, int8_t& deferred) {
+    deferred = ARDA_MAX_TASKS;
+    for (int8_t hops = 0; hops < ARDA_MAX_TASKS; hops++) {  // Acyclic: chains are shorter
+        int8_t pending = -1;
+        bool gated = false;
+        for (int8_t k = 0; k < ARDA_MAX_DEPENDENCIES; k++) {
+            if (deps_[k].after != id || deps_[k].before < 0) continue;
+            if (depPending_(readyMask, deps_[k].before)) {
+                pending = deps_[k].before;
+                break;
+            }
+            if (deps_[k].onlyIfRan && !checkRanThisCycle_(deps_[k].before)) gated = true;
+        }
+        if (pending < 0) return gated ? -1 : id;
+        setMaskBit(readyMask[readyLevel(tasks[id])], id);  // Runs after 'pending'
+        if (id < deferred) deferred = id;
+        for (uint8_t p = 0; p < ARDA_READY_LEVELS; p++) {
+            readyMask[p][pending >> 3] &= (uint8_t)~(1 << (pending & 7));
+        }
+        id = pending;
+    }
+    return id;
 }
 
-int8_t Arda::resumeAllTasks() {
-    // Snapshot task IDs to protect against callbacks modifying the task array
-    int8_t snapshot[ARDA_MAX_TASKS];
-    int8_t snapshotCount = 0;
-    for (int8_t i = 0; i < taskCount; i++) {
-        if (!isDeleted(tasks[i]) && extractState(tasks[i]) == TaskState::Paused) {
-            snapshot[snapshotCount++] = i;
+// After 'id' ran: make the targets of its onlyIfRan edges ready for the rest of
+// this cycle (triggeredMask_ keeps them across mask rebuilds). Returns the lowest
+// released ID (ARDA_MAX_TASKS if none).
+int8_t Arda::depRelease_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], int8_t id) {
+    int8_t lowest = ARDA_MAX_TASKS;
+    for (int8_t k = 0; k < ARDA_MAX_DEPENDENCIES; k++) {
+        if (deps_[k].before != id || !deps_[k].onlyIfRan) continue;
+        int8_t next = deps_[k].after;
+        if (extractState(tasks[next]) != TaskState::Running || taskLoop(tasks[next]) == nullptr) continue;
+        if (checkRanThisCycle_(next)) continue;
+        setMaskBit(triggeredMask_, next);
+        setMaskBit(readyMask[readyLevel(tasks[next])], next);
+        if (next < lowest) lowest = next;
+    }
+    return lowest;
+}
+
+bool Arda::addDependency(int8_t before, int8_t after, bool onlyIfRan) {
+    if (!isValidTask(before) || !isValidTask(after) || before == after) {
+        error_ = ArdaError::InvalidId;
+        return false;
+    }
+    int8_t slot = -1;
+    for (int8_t k = 0; k < ARDA_MAX_DEPENDENCIES; k++) {
+        if (deps_[k].before == before && deps_[k].after == after) {
+            deps_[k].onlyIfRan = onlyIfRan;
+            error_ = ArdaError::Ok;
+            return true;
         }
+        if (slot < 0 && deps_[k].before < 0) slot = k;
+    }
+    if (depReaches_(after, before)) {
+        error_ = ArdaError::InvalidValue;  // Would close a cycle
+        return false;
+    }
+    if (slot < 0) {
+        error_ = ArdaError::NoDependencies;
+        return false;
     }
+    deps_[slot].before = before;
+    deps_[slot].after = after;
+    deps_[slot].onlyIfRan = onlyIfRan;
+    depRefresh_();
+    error_ = ArdaError::Ok;
+    return true;
+}
 
-    int8_t succeeded = 0;
-    ArdaError firstError = ArdaError::Ok;
-    for (int8_t j = 0; j < snapshotCount; j++) {
-        int8_t i = snapshot[j];
-        if (!isValidTask(i)) continue;  // Task was deleted since snapshot
-        if (extractState(tasks[i]) != TaskState::Paused) continue;  // State changed since snapshot
-        if (resumeTask(i)) {
-            succeeded++;
-        } else if (firstError == ArdaError::Ok) {
-            firstError = error_;
+bool Arda::removeDependency(int8_t before, int8_t after) {
+    for (int8_t k = 0; k < ARDA_MAX_DEPENDENCIES; k++) {
+        if (deps_[k].before >= 0 && deps_[k].before == before && deps_[k].after == after) {
+            deps_[k].before = -1;
+            deps_[k].after = -1;
+            depRefresh_();
+            readyGen_++;  // 'after' may no longer be gated
+            error_ = ArdaError::Ok;
+            return true;
         }
     }
-    if (firstError != ArdaError::Ok) {
-        error_ = firstError;
-    } else {
-        error_ = ArdaError::Ok;
+    error_ = ArdaError::InvalidId;
+    return false;
+}
+
+bool Arda::hasDependency(int8_t before, int8_t after) const {
+    for (int8_t k = 0; k < ARDA_MAX_DEPENDENCIES; k++) {
+        if (deps_[k].before >= 0 && deps_[k].before == before && deps_[k].after == after) return true;
     }
-    return succeeded;
+    return false;
 }
+#endif
 
 // =============================================================================
 // Task queries
@@ -1757,7 +3037,7 @@ const char* Arda::getTaskName(int8_t taskId) const {
 #else
 const char* Arda::getTaskName(int8_t taskId) const {
     if (!isValidTask(taskId)) return nullptr;
-    return tasks[taskId].name;
+    return taskName(tasks[taskId]);
 }
 #endif
 
@@ -1777,9 +3057,57 @@ uint32_t Arda::getTaskInterval(int8_t taskId) const {
     if (!isValidTask(taskId)) {
         return 0;
     }
+#ifdef ARDA_PROTOTHREADS
+    if (tasks[taskId].mode & ARDA_MODE_PT_SLEEP_BIT) {
+        return tasks[taskId].ptInterval;  // 'interval' holds the ARDA_SLEEP time
+    }
+#endif
+#ifdef ARDA_COROUTINES
+    int8_t k = coroSlot_(taskId);
+    if (k >= 0 && coro_[k].sleeping) {
+        return coro_[k].savedInterval;  // 'interval' holds the sleep() time
+    }
+#endif
     return tasks[taskId].interval;
 }
 
+bool Arda::isTaskMicros(int8_t taskId) const {
+    if (!isValidTask(taskId)) {
+        return false;
+    }
+    return (tasks[taskId].flags & ARDA_TASK_MICROS_BIT) != 0;
+}
+
+TaskTiming Arda::getTaskTiming(int8_t taskId) const {
+    if (!isValidTask(taskId)) {
+        return TaskTiming::FixedDelay;
+    }
+    return static_cast<TaskTiming>(tasks[taskId].mode & ARDA_MODE_TIMING_MASK);
+}
+
+#ifdef ARDA_COROUTINES
+bool Arda::isTaskCoroutine(int8_t taskId) const {
+    if (!isValidTask(taskId)) {
+        return false;
+    }
+    return (tasks[taskId].mode & ARDA_MODE_CORO_BIT) != 0;
+}
+#endif
+
+bool Arda::isTaskEventMode(int8_t taskId) const {
+    if (!isValidTask(taskId)) {
+        return false;
+    }
+    return (tasks[taskId].notify & ARDA_NOTIFY_EVENT_BIT) != 0;
+}
+
+uint8_t Arda::getTaskNotification(int8_t taskId) const {
+    if (!isValidTask(taskId)) {
+        return 0;
+    }
+    return tasks[taskId].notify & ARDA_NOTIFY_MASK;
+}
+
 #ifdef ARDA_TASK_RECOVERY
 uint32_t Arda::getTaskTimeout(int8_t taskId) const {
     if (!isValidTask(taskId)) {
@@ -1825,9 +3153,26 @@ int8_t Arda::findTaskByName(const char* name) const {
 #else
 int8_t Arda::findTaskByName(const char* name) const {
     if (name == nullptr) return -1;
+#ifdef ARDA_NAME_INDEX
+    return nameIndexFind_(name, false);
+#endif
+
+    for (int8_t i = 0; i < taskCount; i++) {
+        if (!isDeleted(tasks[i]) && nameEquals(taskName(tasks[i]), name)) {
+            return i;
+        }
+    }
+    return -1;
+}
+#endif
 
+#ifdef ARDA_FLASH_NAMES
+int8_t Arda::findTaskByStoredName_(const char* name) const {
+#ifdef ARDA_NAME_INDEX
+    return nameIndexFind_(name, true);
+#endif
     for (int8_t i = 0; i < taskCount; i++) {
-        if (!isDeleted(tasks[i]) && nameEquals(tasks[i].name, name)) {
+        if (!isDeleted(tasks[i]) && nameEquals(taskName(tasks[i]), name, true)) {
             return i;
         }
     }
@@ -1850,17 +3195,17 @@ int8_t Arda::getValidTaskIds(int8_t* outIds, int8_t maxCount) const {
 
 bool Arda::hasTaskSetup(int8_t taskId) const {
     if (!isValidTask(taskId)) return false;
-    return tasks[taskId].setup != nullptr;
+    return taskSetup(tasks[taskId]) != nullptr;
 }
 
 bool Arda::hasTaskLoop(int8_t taskId) const {
     if (!isValidTask(taskId)) return false;
-    return tasks[taskId].loop != nullptr;
+    return taskLoop(tasks[taskId]) != nullptr;
 }
 
 bool Arda::hasTaskTeardown(int8_t taskId) const {
     if (!isValidTask(taskId)) return false;
-    return tasks[taskId].teardown != nullptr;
+    return taskTeardown(tasks[taskId]) != nullptr;
 }
 
 // =============================================================================
@@ -1881,12 +3226,37 @@ void Arda::setTraceCallback(TraceCallback callback) {
     traceCallback = callback;
 }
 
+void Arda::setIdleCallback(IdleCallback callback) {
+    idleCallback = callback;
+}
+
+void Arda::setDeferHandler(DeferHandler handler) {
+    deferHandler = handler;
+}
+
+bool Arda::setClockSource(ClockSource clock) {
+    if (flags_ & FLAG_BEGUN) {
+        error_ = ArdaError::AlreadyBegun;
+        return false;
+    }
+    clock_ = clock ? clock : ardaDefaultClock;
+    return true;
+}
+
 // =============================================================================
 // Utility
 // =============================================================================
 
-#ifdef ARDA_YIELD
+#if defined(ARDA_YIELD) || defined(ARDA_COROUTINES)
 void Arda::yield() {
+#ifdef ARDA_COROUTINES
+    // A coroutine simply parks its context; the scheduler stack never grows
+    if (coroInBody_()) {
+        coroSuspend_();
+        return;
+    }
+#endif
+#ifdef ARDA_YIELD
     // Give other tasks a chance to run while this task waits.
     // Skips the currently executing task to prevent infinite recursion,
     // but allows other ready tasks to execute.
@@ -1901,13 +3271,11 @@ void Arda::yield() {
         // If yield() is called outside run() (e.g., from setup/teardown), clear
         // stale ranThisCycle flags from previous cycles to allow ready tasks to run.
         // The yielding task keeps its flag to prevent double execution.
-        // Exception: during begin() task-start loop, bit 2 is "shouldAutoStart" not "ranThisCycle"
+        // Exception: during begin()'s task-start loop, tasks it already started keep their marks
         if (!wasInRun && !(flags_ & FLAG_IN_BEGIN)) {
-            for (int8_t i = 0; i < taskCount; i++) {
-                if (!isDeleted(tasks[i]) && i != yieldingTask) {
-                    updateRanThisCycle(tasks[i], false);
-                }
-            }
+            bool yieldingRan = checkRanThisCycle_(yieldingTask);
+            memset(ranMask_, 0, sizeof(ranMask_));
+            updateRanThisCycle_(yieldingTask, yieldingRan);
         }
 
         updateInYield(tasks[yieldingTask], true);  // Mark as yielding (prevents deletion)
@@ -1916,6 +3284,175 @@ void Arda::yield() {
         if (wasInRun) flags_ |= FLAG_IN_RUN; else flags_ &= ~FLAG_IN_RUN;  // Restore original state
         updateInYield(tasks[yieldingTask], false);  // No longer yielding
     }
+#endif
+}
+#endif
+
+#ifdef ARDA_PROTOTHREADS
+// -----------------------------------------------------------------------------
+// Protothreads: the macros keep a resume point in the task and, when waiting,
+// tell the scheduler when to run it next - ARDA_SLEEP borrows the interval so the
+// task waits in the deadline heap, ARDA_AWAIT_NOTIFY borrows event mode. Both
+// are undone by ptWake_() right before the task's next loop().
+// -----------------------------------------------------------------------------
+
+uint16_t& Arda::taskResumePoint() {
+    static uint16_t outside;  // Outside a task: always "from the top"
+    if (currentTask < 0) {
+        outside = 0;
+        return outside;
+    }
+    return tasks[currentTask].resume;
+}
+
+void Arda::sleepCurrentTask(uint32_t ms) {
+    int8_t id = currentTask;
+    if (id < 0) return;
+    Task& t = tasks[id];
+    if (!(t.mode & ARDA_MODE_PT_SLEEP_BIT)) {
+        t.ptInterval = t.interval;
+        t.mode |= ARDA_MODE_PT_SLEEP_BIT;
+    }
+    uint32_t span = ms;
+    if (t.flags & ARDA_TASK_MICROS_BIT) {
+        span = (ms > ARDA_MAX_INTERVAL / 1000) ? ARDA_MAX_INTERVAL : ms * 1000;
+    } else if (span > ARDA_MAX_INTERVAL) {
+        span = ARDA_MAX_INTERVAL;
+    }
+    t.interval = span;
+    t.lastRun = taskClock_(id);
+    schedUpdate_(id);
+}
+
+void Arda::waitCurrentTaskNotify() {
+    int8_t id = currentTask;
+    if (id < 0 || (tasks[id].notify & ARDA_NOTIFY_EVENT_BIT)) return;  // Already event-driven
+    tasks[id].notify |= ARDA_NOTIFY_EVENT_BIT;
+    tasks[id].mode |= ARDA_MODE_PT_EVENT_BIT;
+    schedUpdate_(id);
+}
+
+void Arda::ptWake_(int8_t id) {
+    uint8_t m = tasks[id].mode;
+    if (m & ARDA_MODE_PT_SLEEP_BIT) tasks[id].interval = tasks[id].ptInterval;
+    if (m & ARDA_MODE_PT_EVENT_BIT) tasks[id].notify &= (uint8_t)~ARDA_NOTIFY_EVENT_BIT;
+    tasks[id].mode = m & (uint8_t)~(ARDA_MODE_PT_SLEEP_BIT | ARDA_MODE_PT_EVENT_BIT);
+}
+#endif
+
+#ifdef ARDA_COROUTINES
+// -----------------------------------------------------------------------------
+// Coroutines: a coroutine task's loop() is its body, entered on its own stack via
+// ucontext. coroResume_() switches in from dispatchTask_(); yield()/sleep() switch
+// back out to coroReturn_, leaving the body's frames parked on its stack.
+// -----------------------------------------------------------------------------
+
+Arda* Arda::coroSelf_ = nullptr;
+
+void Arda::coroEntry_() {
+    Arda* self = coroSelf_;
+    Coroutine_& c = self->coro_[self->coroCurrent_];
+    taskLoop(self->tasks[c.taskId])();
+    c.active = false;  // Body finished: the next dispatch starts it over
+    setcontext(&self->coroReturn_);
+}
+
+int8_t Arda::coroSlot_(int8_t taskId) const {
+    for (int8_t k = 0; k < ARDA_MAX_COROUTINES; k++) {
+        if (coro_[k].taskId == taskId) return k;
+    }
+    return -1;
+}
+
+// True when the caller is the running coroutine's own body, not a callback nested
+// inside it - only then is it safe to park the stack and unwind callbackDepth.
+bool Arda::coroInBody_() const {
+    return coroCurrent_ >= 0 && currentTask == coro_[coroCurrent_].taskId &&
+           callbackDepth == coroDepth_;
+}
+
+void Arda::coroResume_(int8_t id) {
+    int8_t k = coroSlot_(id);
+    if (k < 0 || coroCurrent_ >= 0) return;  // No slot, or already on a coroutine stack
+    Coroutine_& c = coro_[k];
+    if (c.sleeping) {
+        tasks[id].interval = c.savedInterval;  // Woken: back to the task's own interval
+        c.sleeping = false;
+    }
+    if (!c.active) {
+        getcontext(&c.ctx);
+        c.ctx.uc_stack.ss_sp = c.stack;
+        c.ctx.uc_stack.ss_size = c.stackSize;
+        c.ctx.uc_link = nullptr;
+        makecontext(&c.ctx, coroEntry_, 0);
+        c.active = true;
+    }
+    coroCurrent_ = k;
+    coroDepth_ = callbackDepth;
+    coroSelf_ = this;
+    swapcontext(&coroReturn_, &c.ctx);
+    coroCurrent_ = -1;
+}
+
+void Arda::coroSuspend_() {
+    swapcontext(&coro_[coroCurrent_].ctx, &coroReturn_);
+}
+
+bool Arda::sleep(uint32_t ms) {
+    if (!coroInBody_()) {
+        error_ = ArdaError::WrongState;
+        return false;
+    }
+    Coroutine_& c = coro_[coroCurrent_];
+    int8_t id = c.taskId;
+    uint32_t span = ms;
+    if (tasks[id].flags & ARDA_TASK_MICROS_BIT) {
+        span = (ms > ARDA_MAX_INTERVAL / 1000) ? ARDA_MAX_INTERVAL : ms * 1000;
+    } else if (span > ARDA_MAX_INTERVAL) {
+        span = ARDA_MAX_INTERVAL;
+    }
+    c.sleepFor = span;
+    c.sleepStart = taskClock_(id);
+    c.sleepPending = true;
+    coroSuspend_();
+    error_ = ArdaError::Ok;
+    return true;
+}
+
+// The sleep is expressed as a temporary interval measured from the sleep() call,
+// so the task waits in the deadline heap like any other instead of being polled.
+void Arda::coroApplySleep_(int8_t id) {
+    int8_t k = coroSlot_(id);
+    if (k < 0 || !coro_[k].sleepPending) return;
+    Coroutine_& c = coro_[k];
+    c.sleepPending = false;
+    if (!c.sleeping) {
+        c.savedInterval = tasks[id].interval;
+        c.sleeping = true;
+    }
+    tasks[id].interval = c.sleepFor;
+    tasks[id].lastRun = c.sleepStart;
+}
+
+void Arda::coroRewind_(int8_t id) {
+    int8_t k = coroSlot_(id);
+    if (k < 0) return;
+    Coroutine_& c = coro_[k];
+    c.active = false;
+    c.sleepPending = false;
+    if (c.sleeping) {
+        tasks[id].interval = c.savedInterval;
+        c.sleeping = false;
+    }
+}
+
+void Arda::coroClear_() {
+    for (int8_t k = 0; k < ARDA_MAX_COROUTINES; k++) {
+        coro_[k].taskId = -1;
+        coro_[k].active = false;
+        coro_[k].sleepPending = false;
+        coro_[k].sleeping = false;
+    }
 }
 #endif
 
@@ -1923,7 +3460,7 @@ uint32_t Arda::uptime() const {
     if (!(flags_ & FLAG_BEGUN)) {
         return 0;
     }
-    return millis() - startTime;
+    return clock_() - startTime;
 }
 
 // =============================================================================
@@ -1961,6 +3498,12 @@ const char* Arda::errorString(ArdaError error) {
         case ArdaError::InvalidValue:  return "InvalidValue";
 #ifdef ARDA_TASK_RECOVERY
         case ArdaError::TaskAborted:   return "Aborted";
+#endif
+#if ARDA_MAX_TIMERS > 0
+        case ArdaError::NoTimers:      return "NoTimers";
+#endif
+#if ARDA_MAX_DEPENDENCIES > 0
+        case ArdaError::NoDependencies: return "NoDeps";
 #endif
         default:                       return "Unknown";
 #else
@@ -1984,6 +3527,12 @@ const char* Arda::errorString(ArdaError error) {
         case ArdaError::InvalidValue:  return "Value out of range";
 #ifdef ARDA_TASK_RECOVERY
         case ArdaError::TaskAborted:   return "Task forcibly aborted (timeout)";
+#endif
+#if ARDA_MAX_TIMERS > 0
+        case ArdaError::NoTimers:      return "No free timers";
+#endif
+#if ARDA_MAX_DEPENDENCIES > 0
+        case ArdaError::NoDependencies: return "No free dependency slots";
 #endif
         default:                       return "Unknown error";
 #endif
@@ -2019,6 +3568,152 @@ void Arda::freeSlot(int8_t slot) {
     freeListHead = slot;
 }
 
+// -----------------------------------------------------------------------------
+// Ready structures: interval-0 tasks live in everyCycleMask_ (by level), interval
+// tasks in a min-heap keyed on their next due time (lastRun + interval). Both hold
+// exactly the Running tasks that have a loop() and are not held by a paused
+// group; schedUpdate_() re-files one task after anything that changes its state,
+// interval, lastRun, priority or held status.
+// -----------------------------------------------------------------------------
+
+void Arda::schedUpdate_(int8_t id) {
+    for (uint8_t p = 0; p < ARDA_READY_LEVELS; p++) {
+        everyCycleMask_[p][id >> 3] &= (uint8_t)~(1 << (id & 7));
+    }
+    bool queued = !isDeleted(tasks[id]) && extractState(tasks[id]) == TaskState::Running &&
+                  taskLoop(tasks[id]) != nullptr;
+#if ARDA_MAX_GROUPS > 0
+    if (isHeld_(id)) queued = false;  // Re-filed by groupRefresh_() on resume
+#endif
+    if (!queued) {
+        carryMask_[id >> 3] &= (uint8_t)~(1 << (id & 7));  // No longer owed a budget carry-over
+    } else {
+        // Interval-0 tasks are ready every cycle; event tasks only while notified
+        uint8_t notify = tasks[id].notify;
+        bool ready = (notify & ARDA_NOTIFY_EVENT_BIT) ? (notify & ARDA_NOTIFY_MASK) != 0
+                                                       : tasks[id].interval == 0;
+        if (ready) setMaskBit(everyCycleMask_[readyLevel(tasks[id])], id);
+        if (tasks[id].interval == 0) queued = false;  // No deadline to track
+    }
+    // Find the heap currently holding the task (its unit may have just changed)
+    int8_t pos = duePos_[id];
+    uint8_t heap = (pos >= 0 && pos < dueCount_[HEAP_US] && dueHeap_[HEAP_US][pos] == id)
+                   ? HEAP_US : HEAP_MS;
+    uint8_t target = (tasks[id].flags & ARDA_TASK_MICROS_BIT) ? HEAP_US : HEAP_MS;
+    if (pos >= 0 && (!queued || heap != target)) {
+        heapRemoveAt_(heap, pos);
+        pos = -1;
+    }
+    if (!queued) return;
+    if (pos < 0) {
+        pos = dueCount_[target]++;
+        dueHeap_[target][pos] = id;
+        duePos_[id] = pos;
+    }
+    heapSiftDown_(target, heapSiftUp_(target, pos));  // Key may have moved either way
+}
+
+void Arda::schedClear_() {
+    memset(everyCycleMask_, 0, sizeof(everyCycleMask_));
+    for (int8_t i = 0; i < ARDA_MAX_TASKS; i++) {
+        duePos_[i] = -1;
+    }
+    dueCount_[HEAP_MS] = 0;
+    dueCount_[HEAP_US] = 0;
+    memset(carryMask_, 0, sizeof(carryMask_));
+    memset(ranMask_, 0, sizeof(ranMask_));
+}
+
+// ranThisCycle lives in a dense bitmask rather than in each task's flags, so
+// the per-cycle reset in runInternal() is a single memset.
+bool Arda::checkRanThisCycle_(int8_t id) const {
+    return (ranMask_[id >> 3] & (1 << (id & 7))) != 0;
+}
+
+void Arda::updateRanThisCycle_(int8_t id, bool val) {
+    if (val) setMaskBit(ranMask_, id);
+    else ranMask_[id >> 3] &= (uint8_t)~(1 << (id & 7));
+}
+
+uint32_t Arda::taskClock_(int8_t id) const {
+    return (tasks[id].flags & ARDA_TASK_MICROS_BIT) ? ardaMicrosClock() : clock_();
+}
+
+// FixedDelay anchors the next run on the actual start. FixedRate and CatchUp keep
+// lastRun on the interval grid (lastRun + k*interval) so lateness never turns
+// into drift; they differ only in how many missed slots they leave owed.
+void Arda::advanceLastRun_(int8_t id, uint32_t start) {
+    uint32_t interval = tasks[id].interval;
+    TaskTiming timing = static_cast<TaskTiming>(tasks[id].mode & ARDA_MODE_TIMING_MASK);
+    if (interval == 0 || timing == TaskTiming::FixedDelay) {
+        tasks[id].lastRun = start;
+        return;
+    }
+    // Ran early (runImmediately, notification, interval shortened): restart the grid
+    uint32_t late = start - tasks[id].lastRun;
+    if (late < interval) {
+        tasks[id].lastRun = start;
+        return;
+    }
+    uint32_t owed = late / interval - 1;  // Whole slots missed besides this one
+    if (timing == TaskTiming::FixedRate || owed > ARDA_MAX_CATCHUP) {
+        tasks[id].lastRun = start - late % interval;  // Latest slot at or before start
+    } else {
+        tasks[id].lastRun += interval;                // CatchUp: next slot is still owed
+    }
+}
+
+// Heap order: earlier deadline first. Deadlines are compared as a signed
+// difference so the order survives clock wraparound (intervals are capped
+// at ARDA_MAX_INTERVAL to keep every difference within int32_t).
+bool Arda::dueBefore_(int8_t a, int8_t b) const {
+    uint32_t dueA = tasks[a].lastRun + tasks[a].interval;
+    uint32_t dueB = tasks[b].lastRun + tasks[b].interval;
+    return (int32_t)(dueA - dueB) < 0;
+}
+
+int8_t Arda::heapSiftUp_(uint8_t heap, int8_t pos) {
+    int8_t* h = dueHeap_[heap];
+    int8_t id = h[pos];
+    while (pos > 0) {
+        int8_t parent = (int8_t)((pos - 1) / 2);
+        if (!dueBefore_(id, h[parent])) break;
+        h[pos] = h[parent];
+        duePos_[h[pos]] = pos;
+        pos = parent;
+    }
+    h[pos] = id;
+    duePos_[id] = pos;
+    return pos;
+}
+
+void Arda::heapSiftDown_(uint8_t heap, int8_t pos) {
+    int8_t* h = dueHeap_[heap];
+    int8_t count = dueCount_[heap];
+    int8_t id = h[pos];
+    while (true) {
+        int16_t child = 2 * pos + 1;  // int16_t: 2*126+1 overflows int8_t
+        if (child >= count) break;
+        if (child + 1 < count && dueBefore_(h[child + 1], h[child])) child++;
+        if (!dueBefore_(h[child], id)) break;
+        h[pos] = h[child];
+        duePos_[h[pos]] = pos;
+        pos = (int8_t)child;
+    }
+    h[pos] = id;
+    duePos_[id] = pos;
+}
+
+void Arda::heapRemoveAt_(uint8_t heap, int8_t pos) {
+    int8_t* h = dueHeap_[heap];
+    duePos_[h[pos]] = -1;
+    int8_t last = --dueCount_[heap];
+    if (pos == last) return;  // Removed the last element
+    h[pos] = h[last];
+    duePos_[h[pos]] = pos;
+    heapSiftDown_(heap, heapSiftUp_(heap, pos));
+}
+
 void Arda::emitTrace(int8_t taskId, TraceEvent event) {
     // Depth check prevents unbounded recursion if trace callback triggers more traces
     if (traceCallback && callbackDepth < ARDA_MAX_CALLBACK_DEPTH) {
@@ -2028,7 +3723,21 @@ void Arda::emitTrace(int8_t taskId, TraceEvent event) {
     }
 }
 
-#ifndef ARDA_NO_NAMES
+#ifdef ARDA_FLASH_NAMES
+bool Arda::nameEquals(const char* a, const char* b, bool bInFlash) {
+    for (uint8_t n = 0; n < ARDA_MAX_NAME_LEN; n++, a++, b++) {
+        char ca = ARDA_NAME_BYTE(a);
+        char cb = bInFlash ? ARDA_NAME_BYTE(b) : *b;
+#ifdef ARDA_CASE_INSENSITIVE_NAMES
+        if (ca >= 'A' && ca <= 'Z') ca += 32;
+        if (cb >= 'A' && cb <= 'Z') cb += 32;
+#endif
+        if (ca != cb) return false;
+        if (ca == '\0') return true;
+    }
+    return true;  // Equal for ARDA_MAX_NAME_LEN chars, like strncmp()
+}
+#elif !defined(ARDA_NO_NAMES)
 bool Arda::nameEquals(const char* a, const char* b) {
 #ifdef ARDA_CASE_INSENSITIVE_NAMES
     // Case-insensitive comparison (ASCII letters A-Z only; extended ASCII/UTF-8 compared as-is)
@@ -2050,13 +3759,121 @@ bool Arda::nameEquals(const char* a, const char* b) {
 }
 #endif
 
+#ifdef ARDA_NAME_INDEX
+// -----------------------------------------------------------------------------
+// Name index: open addressing with linear probing over nameIndex_. Entries are
+// task IDs. Removal shifts later entries of the probe chain back (no tombstones),
+// so the table only ever holds live entries and at least
+// ARDA_NAME_INDEX_SIZE - ARDA_MAX_TASKS empty slots end every chain, however many
+// tasks are created and deleted. Lookups stop at an empty slot or after one lap.
+// -----------------------------------------------------------------------------
+
+uint8_t Arda::nameHash_(const char* name, bool inFlash) {
+    uint16_t h = 0;
+    for (uint8_t n = 0; n < ARDA_MAX_NAME_LEN; n++, name++) {
+        char c = inFlash ? ARDA_NAME_BYTE(name) : *name;
+        if (c == '\0') break;
+#ifdef ARDA_CASE_INSENSITIVE_NAMES
+        if (c >= 'A' && c <= 'Z') c += 32;  // Same folding as nameEquals()
+#endif
+        h = (uint16_t)(h * 31 + (uint8_t)c);
+    }
+    return (uint8_t)(h ^ (h >> 8));
+}
+
+int8_t Arda::nameIndexFind_(const char* name, bool inFlash) const {
+    uint16_t pos = nameHash_(name, inFlash) & (ARDA_NAME_INDEX_SIZE - 1);
+    for (uint16_t n = 0; n < ARDA_NAME_INDEX_SIZE; n++) {
+        int8_t id = nameIndex_[pos];
+        if (id == -1) break;
+#ifdef ARDA_FLASH_NAMES
+        if (nameEquals(taskName(tasks[id]), name, inFlash)) return id;
+#else
+        (void)inFlash;
+        if (nameEquals(taskName(tasks[id]), name)) return id;
+#endif
+        pos = (pos + 1) & (ARDA_NAME_INDEX_SIZE - 1);
+    }
+    return -1;
+}
+
+void Arda::nameIndexInsert_(int8_t id) {
+    // At most ARDA_MAX_TASKS live entries in a larger table: a free slot exists
+    uint16_t pos = nameHash_(taskName(tasks[id]), ARDA_NAME_IN_FLASH) & (ARDA_NAME_INDEX_SIZE - 1);
+    while (nameIndex_[pos] >= 0) pos = (pos + 1) & (ARDA_NAME_INDEX_SIZE - 1);
+    nameIndex_[pos] = id;
+}
+
+void Arda::nameIndexRemove_(int8_t id) {
+    constexpr uint16_t mask = ARDA_NAME_INDEX_SIZE - 1;
+    uint16_t hole = nameHash_(taskName(tasks[id]), ARDA_NAME_IN_FLASH) & mask;
+    while (nameIndex_[hole] != id) {
+        if (nameIndex_[hole] == -1) return;  // Not indexed
+        hole = (hole + 1) & mask;
+    }
+    // Backward-shift deletion: pull each later entry of the chain into the hole
+    // unless its home slot lies cyclically in (hole, pos] - moving it would put
+    // it before its home, where lookups never look.
+    nameIndex_[hole] = -1;
+    for (uint16_t pos = (hole + 1) & mask; nameIndex_[pos] != -1; pos = (pos + 1) & mask) {
+        int8_t other = nameIndex_[pos];
+        uint16_t home = nameHash_(taskName(tasks[other]), ARDA_NAME_IN_FLASH) & mask;
+        if (((pos - home) & mask) < ((pos - hole) & mask)) continue;  // Home after the hole
+        nameIndex_[hole] = other;
+        nameIndex_[pos] = -1;
+        hole = pos;
+    }
+}
+
+void Arda::nameIndexClear_() {
+    memset(nameIndex_, -1, sizeof(nameIndex_));
+}
+#endif
+
 // =============================================================================
 // Static helpers
 // =============================================================================
 
+// Name and callbacks of a task: kept in its slot, or with ARDA_TABLE_TASKS read
+// from its table row (PROGMEM on AVR). Unused table-mode slots have no row.
+#ifdef ARDA_TABLE_TASKS
+#ifdef __AVR__
+#define ARDA_ROW_CALLBACK(task, field) reinterpret_cast<TaskCallback>(pgm_read_ptr(&(task).def->field))
+#else
+#define ARDA_ROW_CALLBACK(task, field) ((task).def->field)
+#endif
+static inline const char* taskName(const Task& task) {
+    return task.def ? task.def->name : nullptr;
+}
+static inline TaskCallback taskSetup(const Task& task) {
+    return task.def ? ARDA_ROW_CALLBACK(task, setup) : nullptr;
+}
+static inline TaskCallback taskLoop(const Task& task) {
+    return task.def ? ARDA_ROW_CALLBACK(task, loop) : nullptr;
+}
+static inline TaskCallback taskTeardown(const Task& task) {
+    return task.def ? ARDA_ROW_CALLBACK(task, teardown) : nullptr;
+}
+#else
+#ifndef ARDA_NO_NAMES
+static inline const char* taskName(const Task& task) {
+    return task.name;
+}
+#endif
+static inline TaskCallback taskSetup(const Task& task) {
+    return task.setup;
+}
+static inline TaskCallback taskLoop(const Task& task) {
+    return task.loop;
+}
+static inline TaskCallback taskTeardown(const Task& task) {
+    return task.teardown;
+}
+#endif
+
 // Helper to check if task slot is deleted
 static inline bool isDeleted(const Task& task) {
-#ifdef ARDA_NO_NAMES
+#ifdef ARDA_TASK_DELETED_STATE
     // Use state value 3 (unused) as deletion marker
     return (task.flags & ARDA_TASK_STATE_MASK) == ARDA_TASK_DELETED_STATE;
 #else
@@ -2066,7 +3883,7 @@ static inline bool isDeleted(const Task& task) {
 
 // Helper to mark a task slot as deleted
 static inline void markDeleted(Task& task) {
-#ifdef ARDA_NO_NAMES
+#ifdef ARDA_TASK_DELETED_STATE
     // Set state bits to 3 (deleted), preserve other bits (though they don't matter for deleted tasks)
     task.flags = (task.flags & ~ARDA_TASK_STATE_MASK) | ARDA_TASK_DELETED_STATE;
 #else
@@ -2076,7 +3893,7 @@ static inline void markDeleted(Task& task) {
 
 // Helper to clear the deleted marker (when allocating a slot)
 static inline void clearDeleted(Task& task) {
-#ifdef ARDA_NO_NAMES
+#ifdef ARDA_TASK_DELETED_STATE
     // Set state to Stopped (0) - clears the deleted state
     task.flags &= ~ARDA_TASK_STATE_MASK;
 #else
@@ -2092,13 +3909,6 @@ static inline TaskState extractState(const Task& task) {
 static inline void updateState(Task& task, TaskState state) {
     task.flags = (task.flags & ~ARDA_TASK_STATE_MASK) | static_cast<uint8_t>(state);
 }
-static inline bool checkRanThisCycle(const Task& task) {
-    return (task.flags & ARDA_TASK_RAN_BIT) != 0;
-}
-static inline void updateRanThisCycle(Task& task, bool val) {
-    if (val) task.flags |= ARDA_TASK_RAN_BIT;
-    else task.flags &= ~ARDA_TASK_RAN_BIT;
-}
 #ifdef ARDA_YIELD
 static inline bool checkInYield(const Task& task) {
     return (task.flags & ARDA_TASK_YIELD_BIT) != 0;
@@ -2119,6 +3929,43 @@ static inline void updatePriority(Task& task, uint8_t priority) {
 }
 #endif
 
+// Ready bitmap helpers - one bit per task ID, 8 IDs per byte, one mask per level
+static inline uint8_t readyLevel(const Task& task) {
+#ifndef ARDA_NO_PRIORITY
+    return extractPriority(task);
+#else
+    (void)task;
+    return 0;  // Single level in array-order mode
+#endif
+}
+static inline void setMaskBit(uint8_t* mask, int8_t id) {
+    mask[id >> 3] |= (uint8_t)(1 << (id & 7));
+}
+// Remove and return the lowest ready ID at the highest non-empty level (-1 if none);
+// within that level, IDs set in 'owed' (the budget carry-over) go first
+static inline int8_t takeReadyTask(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], const uint8_t* owed) {
+    for (int8_t p = ARDA_READY_LEVELS - 1; p >= 0; p--) {
+        if (owed) {
+            for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+                uint8_t bits = readyMask[p][b] & owed[b];
+                if (bits) {
+                    readyMask[p][b] &= (uint8_t)~(bits & (uint8_t)-bits);
+                    return (int8_t)((b << 3) + __builtin_ctz(bits));
+                }
+            }
+        }
+        for (uint8_t b = 0; b < ARDA_TASK_MASK_BYTES; b++) {
+            uint8_t bits = readyMask[p][b];
+            if (bits) {
+                readyMask[p][b] = bits & (uint8_t)(bits - 1);  // Clear lowest set bit
+                return (int8_t)((b << 3) + __builtin_ctz(bits));
+            }
+        }
+    }
+    return -1;
+}
+
+
 // =============================================================================
 // Shell Implementation
 // =============================================================================
@@ -2261,7 +4108,7 @@ void Arda::shellCmd_(uint8_t len) {
             }
             break;
         case 'l':
-            shellList_();
+            shellList_(*this, 0);
             break;
 
 #ifndef ARDA_SHELL_MINIMAL
@@ -2282,21 +4129,21 @@ void Arda::shellCmd_(uint8_t len) {
                 TaskState st = getTaskState(id);
                 uint32_t last = getTaskLastRun(id);
                 uint32_t intv = getTaskInterval(id);
+                bool us = isTaskMicros(id);
                 shellStream_->print(F("last:"));
                 // Check runCount to determine if task has ever executed its loop()
                 if (getTaskRunCount(id) == 0) {
                     shellStream_->print(F("never"));
                 } else {
-                    uint32_t now = millis();
-                    uint32_t elapsed = now - last;
+                    uint32_t elapsed = taskClock_(id) - last;
                     shellStream_->print(elapsed);
-                    shellStream_->print(F("ms ago"));
+                    shellStream_->print(us ? F("us ago") : F("ms ago"));
                     // Only show next/due timing for running tasks
                     if (st == TaskState::Running && intv > 0) {
                         if (elapsed < intv) {
                             shellStream_->print(F(" next:"));
                             shellStream_->print(intv - elapsed);
-                            shellStream_->print(F("ms"));
+                            shellStream_->print(us ? F("us") : F("ms"));
                         } else {
                             shellStream_->print(F(" due:now"));
                         }
@@ -2330,8 +4177,10 @@ void Arda::shellCmd_(uint8_t len) {
                     shellStream_->println(F("a <id> <ms>"));
                     break;
                 }
-                uint32_t ms = shellParseArg2_(len);
-                if (!setTaskInterval(id, ms)) {
+                // Value is in the task's own unit (us for createTaskMicros tasks)
+                uint32_t val = shellParseArg2_(len);
+                bool ok = isTaskMicros(id) ? setTaskIntervalMicros(id, val) : setTaskInterval(id, val);
+                if (!ok) {
                     shellStream_->print(F("ERR "));
                     shellStream_->println(errorString(error_));
                 } else {
@@ -2360,7 +4209,7 @@ void Arda::shellCmd_(uint8_t len) {
             }
             break;
 #endif
-#ifndef ARDA_NO_NAMES
+#if !defined(ARDA_NO_NAMES) && !defined(ARDA_FLASH_NAMES)
         case 'n':  // Rename: "n 1 newname"
             if (id < 0) { shellStream_->println(F("n <id> <name>")); break; }
             {
@@ -2448,7 +4297,7 @@ void Arda::shellCmd_(uint8_t len) {
 #ifndef ARDA_NO_PRIORITY
             shellStream_->println(F("y priority"));
 #endif
-#ifndef ARDA_NO_NAMES
+#if !defined(ARDA_NO_NAMES) && !defined(ARDA_FLASH_NAMES)
             shellStream_->println(F("n rename"));
 #endif
             shellStream_->println(F("g go"));
@@ -2487,7 +4336,7 @@ void Arda::shellCmd_(uint8_t len) {
 #ifndef ARDA_NO_PRIORITY
             shellStream_->println(F("y <id> <pri>  set priority"));
 #endif
-#ifndef ARDA_NO_NAMES
+#if !defined(ARDA_NO_NAMES) && !defined(ARDA_FLASH_NAMES)
             shellStream_->println(F("n <id> <name> rename task"));
 #endif
             shellStream_->println(F("g <id>        go (begin+run now)"));
@@ -2512,19 +4361,26 @@ void Arda::shellCmd_(uint8_t len) {
     }
 }
 
-void Arda::shellList_() {
-    for (int8_t i = 0; i < taskCount; i++) {
-        if (isDeleted(tasks[i])) continue;
+void Arda::shellList_(const Arda& sched, uint8_t depth) {
+    for (int8_t i = 0; i < sched.taskCount; i++) {
+        if (isDeleted(sched.tasks[i])) continue;
+        for (uint8_t d = 0; d < depth; d++) shellStream_->print(F("  "));
         shellStream_->print(i);
         shellStream_->print(' ');
-        TaskState st = getTaskState(i);
+        TaskState st = sched.getTaskState(i);
         shellStream_->print(st == TaskState::Running ? 'R' :
                            st == TaskState::Paused ? 'P' : 'S');
 #ifndef ARDA_NO_NAMES
         shellStream_->print(' ');
-        shellStream_->print(tasks[i].name);
+        shellStream_->print(ARDA_NAME_STR(taskName(sched.tasks[i])));
 #endif
         shellStream_->println();
+#ifdef ARDA_CHILD_SCHEDULERS
+        // Mounted subsystem: its tasks follow, indented, with their own (child) IDs.
+        // Depth is bounded in case two schedulers were mounted on each other.
+        const Arda* child = sched.getChildScheduler(i);
+        if (child != nullptr && depth < ARDA_MAX_CALLBACK_DEPTH) shellList_(*child, depth + 1);
+#endif
     }
 }
 
@@ -2536,6 +4392,8 @@ void Arda::shellInfo_(int8_t id) {
     }
     shellStream_->print(F("int:"));
     shellStream_->print(getTaskInterval(id));
+    shellStream_->print(isTaskMicros(id) ? F("us") : F("ms"));
+    if (isTaskEventMode(id)) shellStream_->print(F(" evt"));
     shellStream_->print(F(" runs:"));
     shellStream_->print(getTaskRunCount(id));
 #ifndef ARDA_NO_PRIORITY
@@ -2,8 +2,8 @@
  * Arda - A cooperative multitasking scheduler for Arduino
  *
  * WARNING: NOT INTERRUPT-SAFE. Do not call Arda methods from interrupt handlers
- * (ISRs). If you must interact with Arda from an interrupt, set a volatile flag
- * and check it in your main loop instead.
+ * (ISRs), with the single exception of deferFromISR(), which queues work for
+ * run() to hand to a task. Otherwise set a volatile flag and check it in a task.
  */
 
 #pragma once
@@ -34,18 +34,91 @@
 #if ARDA_MAX_CALLBACK_DEPTH < 1
 #error "ARDA_MAX_CALLBACK_DEPTH must be at least 1"
 #endif
+#ifndef ARDA_MAX_CATCHUP
+#define ARDA_MAX_CATCHUP 8         // Missed slots a TaskTiming::CatchUp task makes up before skipping ahead
+#endif
+#ifndef ARDA_DEFER_QUEUE_SIZE
+#define ARDA_DEFER_QUEUE_SIZE 8    // ISR deferral ring capacity (power of 2, 2-128). ~3 bytes per entry on AVR.
+#endif
+#if ARDA_DEFER_QUEUE_SIZE < 2 || ARDA_DEFER_QUEUE_SIZE > 128 || (ARDA_DEFER_QUEUE_SIZE & (ARDA_DEFER_QUEUE_SIZE - 1))
+#error "ARDA_DEFER_QUEUE_SIZE must be a power of 2 between 2 and 128"
+#endif
+#ifndef ARDA_MAX_TIMERS
+#define ARDA_MAX_TIMERS 0          // Software timer pool (setTimeout/setInterval). 0 = disabled, 12 bytes each on AVR.
+#endif
+#if ARDA_MAX_TIMERS < 0 || ARDA_MAX_TIMERS > 127
+#error "ARDA_MAX_TIMERS must be between 0 and 127"
+#endif
+#ifndef ARDA_MAX_GROUPS
+#define ARDA_MAX_GROUPS 0          // Task groups (pauseGroup/resumeGroup/stopGroup). 0 = disabled, ceil(ARDA_MAX_TASKS/8) bytes each.
+#endif
+#if ARDA_MAX_GROUPS < 0 || ARDA_MAX_GROUPS > 8
+#error "ARDA_MAX_GROUPS must be between 0 and 8"
+#endif
+#ifndef ARDA_MAX_DEPENDENCIES
+#define ARDA_MAX_DEPENDENCIES 0    // Run-after edges (addDependency). 0 = disabled, 3 bytes each.
+#endif
+#if ARDA_MAX_DEPENDENCIES < 0 || ARDA_MAX_DEPENDENCIES > 127
+#error "ARDA_MAX_DEPENDENCIES must be between 0 and 127"
+#endif
+#ifdef ARDA_NAME_INDEX
+  #ifdef ARDA_NO_NAMES
+    #error "ARDA_NAME_INDEX requires task names (remove ARDA_NO_NAMES)"
+  #endif
+  #ifndef ARDA_NAME_INDEX_SIZE       // Open-addressing slots, 1 byte each: 2-4x ARDA_MAX_TASKS
+    #if ARDA_MAX_TASKS <= 4
+      #define ARDA_NAME_INDEX_SIZE 16
+    #elif ARDA_MAX_TASKS <= 8
+      #define ARDA_NAME_INDEX_SIZE 32
+    #elif ARDA_MAX_TASKS <= 16
+      #define ARDA_NAME_INDEX_SIZE 64
+    #elif ARDA_MAX_TASKS <= 32
+      #define ARDA_NAME_INDEX_SIZE 128
+    #else
+      #define ARDA_NAME_INDEX_SIZE 256
+    #endif
+  #endif
+  #if ARDA_NAME_INDEX_SIZE <= ARDA_MAX_TASKS || ARDA_NAME_INDEX_SIZE > 256 || (ARDA_NAME_INDEX_SIZE & (ARDA_NAME_INDEX_SIZE - 1))
+    #error "ARDA_NAME_INDEX_SIZE must be a power of 2 larger than ARDA_MAX_TASKS (max 256)"
+  #endif
+#endif
 
 // Optional features - define before including Arda.h to enable/disable
 // #define ARDA_CASE_INSENSITIVE_NAMES  // Make findTaskByName case-insensitive
 // #define ARDA_NO_GLOBAL_INSTANCE      // Don't create global 'OS' instance (create your own)
 // #define ARDA_NO_PRIORITY             // Disable priority scheduling (saves code size, uses array-order execution)
 // #define ARDA_NO_NAMES                // Disable task names (saves ARDA_MAX_NAME_LEN bytes per task)
+// #define ARDA_FLASH_NAMES             // Keep F()/PROGMEM name pointers instead of copies (2 bytes/task on AVR)
+// #define ARDA_NAME_INDEX              // Hash index for findTaskByName()/duplicate checks (ARDA_NAME_INDEX_SIZE bytes)
+// #define ARDA_TABLE_TASKS             // Tasks come only from static tables; each keeps a row pointer, not name/callbacks
 // #define ARDA_NO_SHELL                // Disable built-in shell task entirely
 // #define ARDA_SHELL_MANUAL_START      // Don't auto-start shell in begin()
 // #define ARDA_SHELL_MINIMAL           // Only core commands (b/s/p/r/k/d/l/h/o)
 // #define ARDA_NO_TASK_RECOVERY        // Disable soft watchdog (AVR only, auto-enabled by default)
 // #define ARDA_WATCHDOG                // Enable hardware watchdog (AVR only, opt-in, resets entire MCU)
 // #define ARDA_YIELD                   // Enable yield() - USE WITH CAUTION (see README)
+// #define ARDA_EDF                     // Enable earliest-deadline-first policy (adds 4 bytes/task)
+// #define ARDA_COROUTINES              // Enable stackful coroutine tasks (hosts with <ucontext.h> only)
+// #define ARDA_PROTOTHREADS            // Enable ARDA_TASK_BEGIN/ARDA_AWAIT/ARDA_SLEEP macros (adds 6 bytes/task)
+// #define ARDA_TASK_CONTEXT            // Enable callbacks taking a void* context (adds 1 pointer/task)
+// #define ARDA_CHILD_SCHEDULERS        // Enable mountScheduler() to run an Arda instance as a task (implies ARDA_TASK_CONTEXT)
+// #define ARDA_CLOCK_SOURCE micros     // Default time source for every instance (see setClockSource)
+// #define ARDA_MICROS_SOURCE myMicros  // Time source for microsecond-interval tasks (default: micros)
+
+// Time source read by the scheduler. Any function returning a 32-bit tick count
+// works (millis, micros, a hardware timer, a virtual clock for tests); intervals,
+// timeouts, lastRun and uptime are all in its ticks.
+#ifndef ARDA_CLOCK_SOURCE
+#define ARDA_CLOCK_SOURCE millis
+#endif
+
+// A mounted scheduler is a context task whose context is the child instance
+#if defined(ARDA_CHILD_SCHEDULERS) && !defined(ARDA_TASK_CONTEXT)
+#define ARDA_TASK_CONTEXT
+#endif
+#ifndef ARDA_MICROS_SOURCE
+#define ARDA_MICROS_SOURCE micros
+#endif
 
 // Shell is only active when enabled AND global instance exists
 #if !defined(ARDA_NO_SHELL) && !defined(ARDA_NO_GLOBAL_INSTANCE)
@@ -62,6 +135,14 @@
 #include <avr/wdt.h>
 #endif
 
+// Static task tables (ARDA_STATIC_TASKS) are placed in flash on AVR
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#define ARDA_PROGMEM PROGMEM
+#else
+#define ARDA_PROGMEM
+#endif
+
 // Task recovery (soft watchdog) - enabled by default on all platforms
 // Provides timeout tracking and callbacks. On AVR with Timer2, also provides
 // hardware abort via setjmp/longjmp to forcibly stop stuck tasks.
@@ -92,7 +173,26 @@
 
 #endif // ARDA_TASK_RECOVERY
 
+// Stackful coroutines - each coroutine task runs on its own caller-provided stack
+// and suspends with yield()/sleep() by switching contexts instead of recursing.
+// Context switching uses POSIX ucontext; no AVR/ARM switch routine is provided yet.
+#ifdef ARDA_COROUTINES
+  #if defined(__AVR__) || !(defined(__unix__) || defined(__APPLE__))
+    #error "ARDA_COROUTINES requires <ucontext.h> (not available on this target)"
+  #endif
+  #include <ucontext.h>
+  #ifndef ARDA_MAX_COROUTINES
+    #define ARDA_MAX_COROUTINES 4        // Coroutine slots per scheduler (~1KB each on glibc)
+  #endif
+  #ifndef ARDA_MIN_CORO_STACK
+    #define ARDA_MIN_CORO_STACK 2048     // Smallest stack createCoroutine() accepts, in bytes
+  #endif
+#endif
+
 typedef void (*TaskCallback)(void);
+#ifdef ARDA_TASK_CONTEXT
+typedef void (*TaskContextCallback)(void* context);  // Receives the pointer given to createTask()
+#endif
 
 // Use uint8_t underlying type to save memory (1 byte instead of 4)
 enum class TaskState : uint8_t {
@@ -125,7 +225,13 @@ enum class ArdaError : uint8_t {
     InCallback,          // Cannot call reset() from within a callback
     NotSupported,        // Feature disabled at compile time (e.g., names when ARDA_NO_NAMES)
     InvalidValue,        // Parameter value out of valid range (e.g., priority > Highest)
-    TaskAborted          // Task was forcibly aborted due to timeout (ARDA_TASK_RECOVERY)
+    TaskAborted,         // Task was forcibly aborted due to timeout (ARDA_TASK_RECOVERY)
+#if ARDA_MAX_TIMERS > 0
+    NoTimers,            // All ARDA_MAX_TIMERS software timers are in use
+#endif
+#if ARDA_MAX_DEPENDENCIES > 0
+    NoDependencies,      // All ARDA_MAX_DEPENDENCIES dependency slots are in use
+#endif
 };
 
 // Result codes for startTask() - disambiguates success from partial success
@@ -148,6 +254,13 @@ enum class StopResult : uint8_t {
 typedef void (*TimeoutCallback)(int8_t taskId, uint32_t actualDurationMs);
 #endif
 typedef void (*StartFailureCallback)(int8_t taskId, ArdaError error);
+typedef void (*IdleCallback)(uint32_t idleMs);  // idleMs = UINT32_MAX when nothing is scheduled
+typedef uint32_t (*ClockSource)(void);          // Returns current time in scheduler ticks
+typedef void (*DeferHandler)(int8_t taskId, uint16_t payload);  // Receives items queued by deferFromISR()
+#if ARDA_MAX_TIMERS > 0
+typedef void (*TimerCallback)(void);
+typedef uint16_t TimerHandle;  // Returned by setTimeout()/setInterval(); 0 = no timer
+#endif
 
 // Debug/trace events for monitoring task lifecycle (11 events).
 // Note: "ing" variants (TaskStarting, TaskStopping) bracket user callbacks (setup/teardown).
@@ -168,6 +281,23 @@ enum class TraceEvent : uint8_t {
 };
 typedef void (*TraceCallback)(int8_t taskId, TraceEvent event);
 
+// How an interval task's next run is timed after it runs (setTaskTiming).
+// lastRun holds the actual start for FixedDelay, the nominal slot otherwise.
+enum class TaskTiming : uint8_t {
+    FixedDelay = 0,  // Next run >= interval after this one started (default; lateness accumulates)
+    FixedRate  = 1,  // Runs on the interval grid; missed slots are skipped, so no drift and no burst
+    CatchUp    = 2   // Runs on the interval grid and makes up missed slots one per cycle,
+                     // skipping ahead once more than ARDA_MAX_CATCHUP slots are owed
+};
+
+#ifdef ARDA_EDF
+// Order in which ready tasks are dispatched (setSchedulerPolicy, per instance)
+enum class SchedulerPolicy : uint8_t {
+    Priority = 0,  // Highest TaskPriority first, then lowest ID (array order with ARDA_NO_PRIORITY)
+    Edf      = 1   // Nearest deadline first (see setTaskDeadline); ties by priority, then ID
+};
+#endif
+
 #ifndef ARDA_NO_PRIORITY
 // Named priority levels (5 levels, higher = runs first)
 enum class TaskPriority : uint8_t {
@@ -181,54 +311,134 @@ enum class TaskPriority : uint8_t {
 
 // Task flags bit positions (packed into single byte for RAM efficiency)
 #define ARDA_TASK_STATE_MASK   0x03  // bits 0-1: TaskState (0=Stopped, 1=Running, 2=Paused)
-#define ARDA_TASK_RAN_BIT      0x04  // bit 2: ranThisCycle
+#define ARDA_TASK_AUTOSTART_BIT 0x04  // bit 2: autoStart pending until begin()
 #ifdef ARDA_YIELD
 #define ARDA_TASK_YIELD_BIT    0x08  // bit 3: inYield
 #endif
 #ifndef ARDA_NO_PRIORITY
-#define ARDA_TASK_PRIORITY_MASK  0x70  // bits 4-6: priority (0-4, 3 bits). Bit 7 reserved.
+#define ARDA_TASK_PRIORITY_MASK  0x70  // bits 4-6: priority (0-4, 3 bits)
 #define ARDA_TASK_PRIORITY_SHIFT 4
 #define ARDA_DEFAULT_PRIORITY    2     // TaskPriority::Normal
+#define ARDA_PRIORITY_LEVELS     5     // Number of TaskPriority levels (one ready bitmap each)
+#endif
+#define ARDA_TASK_MICROS_BIT   0x80  // bit 7: interval/lastRun in microseconds (createTaskMicros)
+
+// Task::mode bit positions
+#define ARDA_MODE_TIMING_MASK  0x03  // bits 0-1: TaskTiming
+#define ARDA_MODE_CORO_BIT     0x04  // bit 2: coroutine task (ARDA_COROUTINES)
+#define ARDA_MODE_PT_SLEEP_BIT 0x08  // bit 3: 'interval' holds an ARDA_SLEEP time (ARDA_PROTOTHREADS)
+#define ARDA_MODE_PT_EVENT_BIT 0x10  // bit 4: event mode set by ARDA_AWAIT_NOTIFY (ARDA_PROTOTHREADS)
+#define ARDA_MODE_CONTEXT_BIT  0x20  // bit 5: callbacks are TaskContextCallback (ARDA_TASK_CONTEXT). Bits 6-7 reserved.
+
+// Task::notify bit positions
+#define ARDA_NOTIFY_MASK       0x7F  // bits 0-6: pending notification bits
+#define ARDA_NOTIFY_EVENT_BIT  0x80  // bit 7: event mode - runs only when notified (or interval elapses)
+#define ARDA_NOTIFY_DEFER      0x40  // Bit set by run() for deferFromISR() items when no DeferHandler is set
+#define ARDA_NOTIFY_QUEUE      0x20  // Default bit an attached ArdaQueue sets on its consumer
+
+// Bytes needed for a one-bit-per-task bitmap (used by the scheduler's ready masks)
+#define ARDA_TASK_MASK_BYTES ((ARDA_MAX_TASKS + 7) / 8)
+// Ready bitmaps: one per priority level, or a single level in array-order mode
+#ifndef ARDA_NO_PRIORITY
+#define ARDA_READY_LEVELS ARDA_PRIORITY_LEVELS
+#else
+#define ARDA_READY_LEVELS 1
 #endif
 
-#ifdef ARDA_NO_NAMES
-// When names are disabled, use state value 3 (unused) as deletion marker.
+// Largest accepted task interval (~24.8 days). Deadlines are ordered by signed
+// difference so the scheduler stays correct across clock wraparound.
+#define ARDA_MAX_INTERVAL 0x7FFFFFFFUL
+
+// Table-backed tasks read their name and callbacks from their ARDA_STATIC_TASKS
+// row, so names behave as with ARDA_FLASH_NAMES (borrowed, PROGMEM on AVR).
+#ifdef ARDA_TABLE_TASKS
+  #if defined(ARDA_NO_NAMES) || defined(ARDA_TASK_CONTEXT) || defined(ARDA_COROUTINES)
+    #error "ARDA_TABLE_TASKS cannot be combined with ARDA_NO_NAMES, ARDA_TASK_CONTEXT/ARDA_CHILD_SCHEDULERS or ARDA_COROUTINES"
+  #endif
+  #ifndef ARDA_FLASH_NAMES
+    #define ARDA_FLASH_NAMES
+  #endif
+#endif
+
+#if defined(ARDA_NO_NAMES) && defined(ARDA_FLASH_NAMES)
+#error "ARDA_FLASH_NAMES and ARDA_NO_NAMES cannot be combined"
+#endif
+
+#if defined(ARDA_NO_NAMES) || defined(ARDA_FLASH_NAMES)
+// When no name is copied into the task, use state value 3 (unused) as deletion marker.
 // This avoids conflict with priority bits (4-7) which would cause false positives.
-#define ARDA_TASK_DELETED_STATE  0x03  // state bits = 3: task deleted (only when ARDA_NO_NAMES)
+#define ARDA_TASK_DELETED_STATE  0x03  // state bits = 3: task deleted (ARDA_NO_NAMES/ARDA_FLASH_NAMES)
+#endif
+
+// Wraps a task name for Print: with ARDA_FLASH_NAMES on AVR, getTaskName()
+// returns a flash pointer, so print it as Serial.print(ARDA_NAME_STR(name)).
+#if defined(ARDA_FLASH_NAMES) && defined(__AVR__)
+#define ARDA_NAME_STR(p) reinterpret_cast<const __FlashStringHelper*>(p)
+#else
+#define ARDA_NAME_STR(p) (p)
 #endif
 
 // Task structure - fields ordered to minimize padding.
-// Memory per task (with ARDA_TASK_RECOVERY enabled, ARDA_MAX_NAME_LEN=16):
-//   AVR (8-bit):  16 + 4*2 + 3*4 + 4 + 1 = ~41 bytes (25 bytes with ARDA_NO_NAMES)
-// Total for 16 tasks on AVR: ~656 bytes (400 bytes with ARDA_NO_NAMES)
+// Memory per task on AVR (with ARDA_TASK_RECOVERY enabled, ARDA_MAX_NAME_LEN=16):
+//   name 16 + setup/loop/teardown/recover 4*2 + interval/lastRun/timeout 3*4
+//   + runCount 4 + flags/notify/mode 3 = 43 bytes (27 with ARDA_NO_NAMES,
+//   29 with ARDA_FLASH_NAMES, 23 with ARDA_TABLE_TASKS, 37 with ARDA_NO_TASK_RECOVERY)
+// Optional fields: deadline +4 (ARDA_EDF), ptInterval + resume +6
+// (ARDA_PROTOTHREADS), context +2 (ARDA_TASK_CONTEXT).
+// Total for 16 tasks on AVR: 688 bytes by default (432 with ARDA_NO_NAMES), plus
+// the scheduler's ready structures (3 bytes/task for the deadline heaps).
+#ifdef ARDA_TABLE_TASKS
+struct ArdaTaskDef;
+#endif
 struct Task {
-#ifndef ARDA_NO_NAMES
+#ifdef ARDA_TABLE_TASKS
+    const ArdaTaskDef* def;       // Static table row holding name and callbacks (nullptr = unused)
+#else
+#ifdef ARDA_FLASH_NAMES
+    const char* name;             // Borrowed F()/PROGMEM string, never copied
+#elif !defined(ARDA_NO_NAMES)
     char name[ARDA_MAX_NAME_LEN]; // Copied, safe from dangling pointers; empty = deleted
 #endif
     TaskCallback setup;           // One-time initialization callback
     TaskCallback loop;            // Repeated execution callback
     TaskCallback teardown;        // Cleanup callback (called on stop)
+#endif
+#ifdef ARDA_TASK_CONTEXT
+    void* context;                // Passed to setup/loop/teardown when ARDA_MODE_CONTEXT_BIT is set
+#endif
 #ifdef ARDA_TASK_RECOVERY
     TaskCallback recover;         // Called after forced abort (can be nullptr)
 #endif
-    uint32_t interval;            // Run interval in ms (0 = every cycle)
+    uint32_t interval;            // Run interval in ms, or us if ARDA_TASK_MICROS_BIT (0 = every cycle)
     uint32_t lastRun;             // Actual execution time (for scheduling and getTaskLastRun)
 #ifdef ARDA_TASK_RECOVERY
     uint32_t timeout;             // Max execution time in ms (0 = disabled)
+#endif
+#ifdef ARDA_EDF
+    uint32_t deadline;            // Relative deadline from lastRun, task's unit (0 = interval)
+#endif
+#ifdef ARDA_PROTOTHREADS
+    uint32_t ptInterval;          // Own interval, saved while ARDA_SLEEP borrows 'interval'
 #endif
     // INVARIANT: This union shares memory between active and deleted task states.
     // - runCount: ONLY valid when task is not deleted. Read via getTaskRunCount().
     // - nextFree: ONLY valid when task is deleted. Used internally for free list.
-// Deletion is indicated by name[0]=='\0' (normal) or ARDA_TASK_DELETED_STATE (ARDA_NO_NAMES).
+// Deletion is indicated by name[0]=='\0' (normal) or ARDA_TASK_DELETED_STATE (ARDA_NO_NAMES/ARDA_FLASH_NAMES).
     // Accessing the wrong member yields garbage. Always check isValidTask() before using runCount.
     union {
         uint32_t runCount;        // Execution count (overflows after ~49 days at 1ms)
         int8_t nextFree;          // Next free slot index (-1 = end of list); internal use only
     };
-    // Packed flags: bits 0-1 = state, bit 2 = ranThisCycle, bit 3 = inYield (if ARDA_YIELD)
-    // When ARDA_NO_NAMES: state value 3 = deleted (ARDA_TASK_DELETED_STATE)
-    // Bits 4-7: priority (when ARDA_NO_PRIORITY is not defined)
+    // Packed flags: bits 0-1 = state, bit 2 = autoStart (before begin()), bit 3 = inYield (if ARDA_YIELD)
+    // When ARDA_NO_NAMES or ARDA_FLASH_NAMES: state value 3 = deleted (ARDA_TASK_DELETED_STATE)
+    // Bits 4-6: priority (when ARDA_NO_PRIORITY is not defined), bit 7 = microsecond interval
     uint8_t flags;
+    // Bits 0-6 = pending notification bits (notifyTask), bit 7 = event mode
+    uint8_t notify;
+    uint8_t mode;                 // Bits 0-1 = TaskTiming, bits 2-4 = coroutine/protothread state, bit 5 = context callbacks
+#ifdef ARDA_PROTOTHREADS
+    uint16_t resume;              // Protothread resume point (__LINE__ of last wait, 0 = top)
+#endif
 };
 
 // Validate ARDA_MAX_TASKS range (must fit in int8_t and be at least 1)
@@ -246,12 +456,27 @@ struct Task {
 #endif
 #endif
 
+// One entry of a static task table for createTasks(). Declare tables with
+// ARDA_STATIC_TASKS so they stay in flash on AVR; the name is stored inline
+// for the same reason (a too-long name is a compile error). By default
+// createTasks() copies each row into a Task slot; with ARDA_TABLE_TASKS the
+// slot points at the row instead and only the mutable fields take RAM.
+struct ArdaTaskDef {
+    char name[ARDA_MAX_NAME_LEN]; // Ignored with ARDA_NO_NAMES
+    TaskCallback setup;
+    TaskCallback loop;
+    TaskCallback teardown;
+    uint32_t interval;            // Milliseconds
+    uint8_t priority;             // TaskPriority value (ignored with ARDA_NO_PRIORITY)
+};
+
 class Arda {
 public:
     // -------------------------------------------------------------------------
     // Constructor
     // -------------------------------------------------------------------------
-    Arda();
+    // clock: time source for this instance, or nullptr for ARDA_CLOCK_SOURCE (millis).
+    explicit Arda(ClockSource clock = nullptr);
 
     // Non-copyable and non-movable: copying/moving would create two schedulers
     // with duplicate task data, which is almost certainly not what you want.
@@ -273,8 +498,19 @@ public:
     // Execute the scheduler. Returns false and sets error if begin() hasn't been called.
     bool run();
 
+    // Tickless idle: run() once, then if no task is due, pass the time until the
+    // next deadline to the idle callback (see setIdleCallback) so the sketch can
+    // sleep instead of spinning. Returns the same as run().
+    bool runOrSleep();
+
+    // Milliseconds until the next task becomes due: 0 if a task is ready now (or a
+    // microsecond task is due within 1ms), UINT32_MAX if nothing is scheduled (no
+    // Running task with a loop, or begin() not called). Interval-0 tasks (including
+    // the shell) are always ready.
+    uint32_t msUntilNextDue() const;
+
     // Stop all tasks and reset scheduler to initial state.
-    // By default, clears user callbacks (timeout, startFailure, trace) for a clean slate.
+    // By default, clears user callbacks (timeout, startFailure, trace, idle, defer) for a clean slate.
     // Set preserveCallbacks=true to keep callbacks registered across reset.
     // Returns true if all teardowns ran successfully, false if any were skipped.
     // Check getError() for ArdaError::CallbackDepth if false is returned.
@@ -282,13 +518,34 @@ public:
 
     bool hasBegun() const;  // Returns true if begin() has been called
 
+    // Bound the time one run() spends dispatching tasks. Once budgetUs (timed with
+    // ARDA_MICROS_SOURCE) has elapsed after a loop() returns, run() stops; ready
+    // tasks it did not reach stay due and go first within their priority level in
+    // the next run() (a higher-priority task that becomes ready still runs before
+    // them). At least one task runs per call. 0 (default) = no limit. Kept across
+    // reset().
+    void setCycleBudgetUs(uint32_t budgetUs);
+    uint32_t getCycleBudgetUs() const;
+
+#ifdef ARDA_EDF
+    // Choose how ready tasks are ordered (default SchedulerPolicy::Priority). Takes
+    // effect from the next dispatch and is kept across reset(). Returns false with
+    // InvalidValue for an unknown policy.
+    bool setSchedulerPolicy(SchedulerPolicy policy);
+    SchedulerPolicy getSchedulerPolicy() const;
+#endif
+
     // -------------------------------------------------------------------------
     // Task creation and deletion
     // -------------------------------------------------------------------------
 
+    // With ARDA_TABLE_TASKS, tasks come only from createTasks(): the create*
+    // calls below, which take callbacks at runtime, are not available.
+#ifndef ARDA_TABLE_TASKS
 #ifdef ARDA_NO_NAMES
     // Simplified createTask without name parameter (ARDA_NO_NAMES mode).
-    // Returns -1 if max tasks reached or auto-start fails (check getError()).
+    // Returns -1 if intervalMs exceeds ARDA_MAX_INTERVAL, max tasks reached,
+    // or auto-start fails (check getError()).
     // Use autoStart=false to handle start failures manually.
     int8_t createTask(TaskCallback setup, TaskCallback loop,
                       uint32_t intervalMs = 0, TaskCallback teardown = nullptr,
@@ -301,14 +558,25 @@ public:
                       bool autoStart = true);
 #else
     // Name is copied, so the original string does not need to remain valid.
+    // With ARDA_FLASH_NAMES only the pointer is kept: pass F()/PSTR()/PROGMEM
+    // strings on AVR (any string that outlives the task elsewhere).
     // Name comparison is case-sensitive ("MyTask" != "mytask").
     // Returns -1 if: name is null/empty, name exceeds ARDA_MAX_NAME_LEN-1 chars,
-    // name is duplicate, max tasks reached, or auto-start fails (check getError()).
+    // name is duplicate, intervalMs exceeds ARDA_MAX_INTERVAL, max tasks reached,
+    // or auto-start fails (check getError()).
     // If begin() was already called and autoStart is true (default), the new task
     // is automatically started. Use autoStart=false to handle start failures manually.
     int8_t createTask(const char* name, TaskCallback setup, TaskCallback loop,
                       uint32_t intervalMs = 0, TaskCallback teardown = nullptr,
                       bool autoStart = true);
+#if defined(ARDA_FLASH_NAMES) && defined(__AVR__)
+    int8_t createTask(const __FlashStringHelper* name, TaskCallback setup, TaskCallback loop,
+                      uint32_t intervalMs = 0, TaskCallback teardown = nullptr,
+                      bool autoStart = true) {
+        return createTask(reinterpret_cast<const char*>(name), setup, loop, intervalMs,
+                          teardown, autoStart);
+    }
+#endif
 #endif
 
 #ifndef ARDA_NO_PRIORITY
@@ -330,6 +598,103 @@ public:
                       TaskPriority priority, uint32_t timeoutMs, TaskCallback recover);
 #endif
 
+    // Create a task whose interval is in microseconds (timed with ARDA_MICROS_SOURCE),
+    // for loops faster than 1 kHz. Same arguments, limits and return value as
+    // createTask(); intervalUs is capped at ARDA_MAX_INTERVAL (~35.8 minutes).
+    // Timeouts stay in milliseconds. See also setTaskIntervalMicros().
+    int8_t createTaskMicros(const char* name, TaskCallback setup, TaskCallback loop,
+                            uint32_t intervalUs, TaskCallback teardown = nullptr,
+                            bool autoStart = true);
+#ifdef ARDA_NO_NAMES
+    int8_t createTaskMicros(TaskCallback setup, TaskCallback loop,
+                            uint32_t intervalUs, TaskCallback teardown = nullptr,
+                            bool autoStart = true);
+#endif
+
+    // Create an event task: it becomes ready only when notifyTask() leaves pending
+    // bits, instead of being polled every cycle. intervalMs > 0 additionally runs it
+    // when that much time passes without a run (a timeout/heartbeat). Same arguments,
+    // limits and return value as createTask(). See also setTaskEventMode().
+    int8_t createEventTask(const char* name, TaskCallback setup, TaskCallback loop,
+                           uint32_t intervalMs = 0, TaskCallback teardown = nullptr,
+                           bool autoStart = true);
+#ifdef ARDA_NO_NAMES
+    int8_t createEventTask(TaskCallback setup, TaskCallback loop,
+                           uint32_t intervalMs = 0, TaskCallback teardown = nullptr,
+                           bool autoStart = true);
+#endif
+#endif  // ARDA_TABLE_TASKS
+
+#ifdef ARDA_TASK_CONTEXT
+    // Create a task whose callbacks receive 'context', so one set of functions can
+    // drive several instances (e.g. one sensor driver per struct). The pointer is
+    // stored, not copied, and must outlive the task. Same arguments, limits and
+    // return value as createTask(); setTaskRecover() callbacks stay void(void).
+    int8_t createTask(const char* name, TaskContextCallback setup, TaskContextCallback loop,
+                      void* context, uint32_t intervalMs = 0,
+                      TaskContextCallback teardown = nullptr, bool autoStart = true);
+#ifdef ARDA_NO_NAMES
+    int8_t createTask(TaskContextCallback setup, TaskContextCallback loop,
+                      void* context, uint32_t intervalMs = 0,
+                      TaskContextCallback teardown = nullptr, bool autoStart = true);
+#endif
+    void* getTaskContext(int8_t taskId) const;  // nullptr if invalid or a plain task
+#endif
+
+#ifdef ARDA_CHILD_SCHEDULERS
+    // Mount another Arda instance as one task of this scheduler: each time the task
+    // is due, child.run() is called. The task's interval and priority decide when the
+    // whole subsystem runs; budgetUs becomes the child's cycle budget (0 = unlimited),
+    // so "at most 2 ms every 10 ms" is mountScheduler("comms", comms, 10, 2000).
+    // While this scheduler has a cycle budget of its own, each child cycle is also
+    // cut to what is left of it, so a child never overruns its parent's budget.
+    // Starting the task calls child.begin() if needed; the child always uses this
+    // scheduler's clock source. A child is mounted on one scheduler at a time (until
+    // the mount task is deleted or this scheduler is reset) and must outlive the
+    // task. Returns the task ID, or -1 with InvalidValue (mounting a scheduler on
+    // itself), WrongState (the child is already mounted), AlreadyBegun (the child
+    // has already begun with a different clock source) or the createTask() errors.
+    int8_t mountScheduler(const char* name, Arda& child, uint32_t intervalMs = 0,
+                          uint32_t budgetUs = 0, bool autoStart = true);
+#ifdef ARDA_NO_NAMES
+    int8_t mountScheduler(Arda& child, uint32_t intervalMs = 0,
+                          uint32_t budgetUs = 0, bool autoStart = true);
+#endif
+    Arda* getChildScheduler(int8_t taskId) const;  // nullptr if invalid or not a mount task
+#endif
+
+#ifdef ARDA_COROUTINES
+    // Create a coroutine task: body runs on 'stack' (stackSize bytes, caller-owned,
+    // must outlive the task) and may suspend with yield() or sleep(), so long jobs
+    // can be written as straight-line code. When body returns, the next dispatch
+    // starts it again from the top; stopTask() also rewinds it (locals on the
+    // abandoned stack are not destroyed). Same scheduling arguments as createTask().
+    // Returns -1 with InvalidValue if stack is null or smaller than
+    // ARDA_MIN_CORO_STACK, or MaxTasks if all ARDA_MAX_COROUTINES slots are in use.
+    int8_t createCoroutine(const char* name, TaskCallback body, void* stack, size_t stackSize,
+                           uint32_t intervalMs = 0, TaskCallback teardown = nullptr,
+                           bool autoStart = true);
+#ifdef ARDA_NO_NAMES
+    int8_t createCoroutine(TaskCallback body, void* stack, size_t stackSize,
+                           uint32_t intervalMs = 0, TaskCallback teardown = nullptr,
+                           bool autoStart = true);
+#endif
+    bool isTaskCoroutine(int8_t taskId) const;  // false if not a coroutine or invalid
+#endif
+
+    // Create every task of a static table (see ARDA_STATIC_TASKS) in order, as if
+    // by createTask() with autoStart and the entry's priority. Batch semantics:
+    // returns the number created; on failure error and failedIndex (table index)
+    // describe the FIRST failed entry, and later entries are still attempted.
+    // With ARDA_TABLE_TASKS the tasks keep pointing into 'table', which must
+    // then outlive them (an ARDA_STATIC_TASKS table always does).
+    int8_t createTasks(const ArdaTaskDef* table, int8_t count, int8_t* failedIndex = nullptr);
+    template <size_t N>
+    int8_t createTasks(const ArdaTaskDef (&table)[N], int8_t* failedIndex = nullptr) {
+        static_assert(N <= ARDA_MAX_TASKS, "Static task table is larger than ARDA_MAX_TASKS");
+        return createTasks(table, (int8_t)N, failedIndex);
+    }
+
     bool deleteTask(int8_t taskId);
 
     // Stop and delete a task in one operation. Handles already-stopped tasks gracefully.
@@ -358,6 +723,44 @@ public:
     bool pauseTask(int8_t taskId);
     bool resumeTask(int8_t taskId);
 
+    // Set notification bits on a task (OR-ed into its pending bits, ARDA_NOTIFY_MASK).
+    // An event task becomes ready while it has pending bits; any task can read them
+    // with takeNotification(). Returns false with InvalidId, or InvalidValue if bits
+    // is 0 or outside ARDA_NOTIFY_MASK. NOT interrupt-safe (see file header).
+    bool notifyTask(int8_t taskId, uint8_t bits);
+
+    // Return and clear the current task's pending notification bits (0 if none or
+    // called outside a task). An event task that does not take its bits stays ready.
+    uint8_t takeNotification();
+
+    // ISR-safe: queue a (taskId, payload) work item for the next run() without
+    // touching scheduler state. run() drains the items queued before it started,
+    // in order: each goes to the DeferHandler if one is set, otherwise the task
+    // is notified with ARDA_NOTIFY_DEFER. Returns false (and counts a drop) if the
+    // ARDA_DEFER_QUEUE_SIZE ring is full. Single producer: call it from ISRs that
+    // cannot preempt each other, or from the main context with interrupts enabled
+    // only if no ISR uses it. Does not set error (errors are not ISR-safe).
+    bool deferFromISR(int8_t taskId, uint16_t payload = 0);
+
+    // Items rejected by deferFromISR() because the ring was full (saturates at 255).
+    uint8_t getDeferDropCount() const;
+
+#if ARDA_MAX_TIMERS > 0
+    // Software timers: a callback without a task slot, name or state, from a pool
+    // of ARDA_MAX_TIMERS. run() fires due timers (earliest first) before tasks.
+    // setTimeout() fires once after ms; setInterval() every ms (> 0) on a fixed
+    // grid, skipping missed periods. ms=0 timeouts fire on the next run().
+    // Returns 0 with InvalidValue (null callback, ms out of range) or NoTimers.
+    // A handle stays unique until its slot has been reused 255 times.
+    TimerHandle setTimeout(TimerCallback callback, uint32_t ms);
+    TimerHandle setInterval(TimerCallback callback, uint32_t ms);
+
+    // Cancel a pending timer (safe from its own callback). Returns false with
+    // InvalidId if the handle is 0, stale or already fired (one-shot).
+    bool cancelTimer(TimerHandle handle);
+    bool isTimerActive(TimerHandle handle) const;
+#endif
+
     // Stop a running or paused task. Returns StopResult enum:
     //   StopResult::Success: Task stopped and teardown ran successfully (or no teardown defined)
     //   StopResult::TeardownSkipped: Task stopped but teardown NOT run (check getError() for CallbackDepth)
@@ -371,7 +774,27 @@ public:
 
     // Change task interval. By default, keeps existing timing (next run based on lastRun + new interval).
     // Set resetTiming=true to reset lastRun to now (task waits full new interval from now).
+    // Returns false with InvalidValue if intervalMs exceeds ARDA_MAX_INTERVAL.
+    // Both setters also switch the task's unit: setTaskInterval() makes it a millisecond
+    // task, setTaskIntervalMicros() a microsecond task (time since lastRun is carried over).
     bool setTaskInterval(int8_t taskId, uint32_t intervalMs, bool resetTiming = false);
+    bool setTaskIntervalMicros(int8_t taskId, uint32_t intervalUs, bool resetTiming = false);
+
+#ifdef ARDA_EDF
+    // Relative deadline used by SchedulerPolicy::Edf: the task's absolute deadline
+    // is lastRun + relDeadline (in the task's unit). 0 (default) uses the interval,
+    // so interval-0 tasks without one are ordered by how long ago they ran.
+    // Returns false with InvalidValue if relDeadline exceeds ARDA_MAX_INTERVAL.
+    bool setTaskDeadline(int8_t taskId, uint32_t relDeadline);
+    uint32_t getTaskDeadline(int8_t taskId) const;  // 0 if unset or invalid
+#endif
+
+    // Choose how an interval task's next run is timed (see TaskTiming). Takes effect
+    // from the next run. Returns false with InvalidId, or InvalidValue for an unknown value.
+    bool setTaskTiming(int8_t taskId, TaskTiming timing);
+
+    // Switch a task into or out of event mode (see createEventTask). Pending bits are kept.
+    bool setTaskEventMode(int8_t taskId, bool enabled);
 
 #ifdef ARDA_TASK_RECOVERY
     bool setTaskTimeout(int8_t taskId, uint32_t timeoutMs);  // 0 = disabled
@@ -404,11 +827,30 @@ public:
     bool setTaskPriority(int8_t taskId, TaskPriority priority);
 
     // Get task priority. Returns TaskPriority::Lowest for invalid tasks.
+    // This is always the base level set above, never the aged one.
     TaskPriority getTaskPriority(int8_t taskId) const;
+
+    // Priority aging: while a task is due but has not been dispatched, it is filed
+    // one level higher for every stepMs it is overdue (up to Highest), and drops
+    // back to its base priority once it runs. 0 (default) disables. Kept across
+    // reset(). Limitation: only tasks with an interval age. Interval-0 and
+    // notified event tasks are always due, so lastRun says nothing about how long
+    // they have waited and they keep their base level; they still run once per
+    // cycle (or first in the next one when a cycle budget cuts them off). Give
+    // such a task a small interval (e.g. 1ms) if it should age.
+    void setPriorityAging(uint16_t stepMs);
+    uint16_t getPriorityAging() const;
 #endif
 
     // Rename a task. Returns false if task invalid, name invalid, or name already exists.
+    // With ARDA_FLASH_NAMES, newName is borrowed like createTask()'s name. Fails with
+    // NotSupported under ARDA_NO_NAMES or ARDA_TABLE_TASKS (the name is the table's).
     bool renameTask(int8_t taskId, const char* newName);
+#if defined(ARDA_FLASH_NAMES) && defined(__AVR__)
+    bool renameTask(int8_t taskId, const __FlashStringHelper* newName) {
+        return renameTask(taskId, reinterpret_cast<const char*>(newName));
+    }
+#endif
 
     // -------------------------------------------------------------------------
     // Batch operations - perform operations on multiple tasks
@@ -429,6 +871,39 @@ public:
     int8_t pauseAllTasks();
     int8_t resumeAllTasks();
 
+#if ARDA_MAX_GROUPS > 0
+    // Task groups 0..ARDA_MAX_GROUPS-1 (name them with an enum). A task may be in
+    // several groups and is held back while any of them is paused. pauseGroup() and
+    // resumeGroup() flip one bit checked at dispatch: members keep their own state
+    // (getTaskState() still says Running), and no per-task trace events fire.
+    // Invalid group -> InvalidValue, invalid task -> InvalidId. Deleting a task
+    // removes it from every group.
+    bool addToGroup(int8_t taskId, uint8_t group);
+    bool removeFromGroup(int8_t taskId, uint8_t group);
+    bool isInGroup(int8_t taskId, uint8_t group) const;
+    bool pauseGroup(uint8_t group);
+    bool resumeGroup(uint8_t group);
+    bool isGroupPaused(uint8_t group) const;
+    bool isTaskHeld(int8_t taskId) const;  // In at least one paused group
+    // stopTask() on every Running/Paused member, with stopTasks() semantics
+    // (teardown runs; returns count stopped; first failure in error/failedId).
+    int8_t stopGroup(uint8_t group, int8_t* failedId = nullptr);
+#endif
+
+#if ARDA_MAX_DEPENDENCIES > 0
+    // Run-after ordering within one run() cycle: whenever 'before' is still due in
+    // the cycle 'after' is dispatched, 'before' runs first - regardless of priority
+    // or ID order, so slot reuse cannot reorder a pipeline. With onlyIfRan, 'after'
+    // also runs only in cycles where 'before' ran, and 'before' running makes it
+    // ready for that cycle (dataflow trigger; make 'after' an event task so it does
+    // not poll). Adding an existing edge updates onlyIfRan. Returns false with
+    // InvalidId (bad ID or before == after), InvalidValue (the edge would close a
+    // cycle) or NoDependencies. Deleting a task removes its edges.
+    bool addDependency(int8_t before, int8_t after, bool onlyIfRan = false);
+    bool removeDependency(int8_t before, int8_t after);  // InvalidId if no such edge
+    bool hasDependency(int8_t before, int8_t after) const;
+#endif
+
     // -------------------------------------------------------------------------
     // Task queries
     // -------------------------------------------------------------------------
@@ -457,18 +932,22 @@ public:
 #endif
     }
 
-    const char* getTaskName(int8_t taskId) const;  // Returns nullptr if invalid
+    const char* getTaskName(int8_t taskId) const;  // Returns nullptr if invalid (flash pointer with ARDA_FLASH_NAMES, see ARDA_NAME_STR)
     TaskState getTaskState(int8_t taskId) const;   // Returns TaskState::Invalid if invalid
 
     // NOTE: These getters return 0 for invalid tasks, but 0 is also a valid value
     // (runCount=0 means not yet run, interval=0 means every cycle).
     // Call isValidTask() first if you need to distinguish invalid from zero.
     uint32_t getTaskRunCount(int8_t taskId) const;  // Runs since last start (reset on each startTask)
-    uint32_t getTaskInterval(int8_t taskId) const;
+    uint32_t getTaskInterval(int8_t taskId) const;  // In the task's unit - see isTaskMicros()
+    bool isTaskMicros(int8_t taskId) const;         // True if interval/lastRun are in microseconds
+    bool isTaskEventMode(int8_t taskId) const;      // True if the task only runs when notified
+    TaskTiming getTaskTiming(int8_t taskId) const;  // TaskTiming::FixedDelay if invalid
+    uint8_t getTaskNotification(int8_t taskId) const;  // Pending bits without clearing (0 if invalid)
 #ifdef ARDA_TASK_RECOVERY
     uint32_t getTaskTimeout(int8_t taskId) const;
 #endif
-    uint32_t getTaskLastRun(int8_t taskId) const;   // millis() snapshot when task last ran (0 if never ran or invalid)
+    uint32_t getTaskLastRun(int8_t taskId) const;   // Clock (or micros) reading when task last ran (0 if never ran or invalid)
 
     int8_t getCurrentTask() const;          // Returns ID of currently executing task, or -1
     bool isValidTask(int8_t taskId) const;  // Returns true if taskId refers to a non-deleted task
@@ -479,6 +958,7 @@ public:
     // Find task by name. Returns task ID or -1 if not found.
     // Name comparison is case-sensitive by default ("MyTask" != "mytask").
     // Define ARDA_CASE_INSENSITIVE_NAMES before including Arda.h for case-insensitive matching.
+    // The query is always a RAM string, also with ARDA_FLASH_NAMES.
     int8_t findTaskByName(const char* name) const;
 
     // Task iteration helper - fills outIds with valid (non-deleted) task IDs.
@@ -508,14 +988,50 @@ public:
     // Set callback for debugging/tracing task execution (set to nullptr to disable)
     void setTraceCallback(TraceCallback callback);
 
+    // Set callback invoked by runOrSleep() with the idle time in ms when no task is due
+    void setIdleCallback(IdleCallback callback);
+
+    // Set handler for deferFromISR() items (nullptr = notify the target task instead)
+    void setDeferHandler(DeferHandler handler);
+
+    // Replace the time source (nullptr restores ARDA_CLOCK_SOURCE). The clock is
+    // read once per dispatch decision and kept across reset(). Returns false with
+    // ArdaError::AlreadyBegun after begin() - existing lastRun values would be
+    // in the old clock's ticks.
+    bool setClockSource(ClockSource clock);
+
     // -------------------------------------------------------------------------
     // Utility
     // -------------------------------------------------------------------------
 
-#ifdef ARDA_YIELD
+#if defined(ARDA_YIELD) || defined(ARDA_COROUTINES)
+    // Inside a coroutine task: suspend it and return to the scheduler; it resumes
+    // here when next dispatched. Elsewhere (ARDA_YIELD only): run other ready tasks
+    // recursively before returning.
     void yield();
 #endif
 
+#ifdef ARDA_PROTOTHREADS
+    // Scheduler side of the ARDA_TASK_BEGIN / ARDA_AWAIT / ARDA_SLEEP / ARDA_TASK_END
+    // macros (use those instead). taskResumePoint() is the running task's resume
+    // point. sleepCurrentTask() keeps the running task out of dispatch for ms (its
+    // interval is borrowed meanwhile and restored on the next dispatch);
+    // waitCurrentTaskNotify() puts it in event mode until its next dispatch.
+    // Outside a task they have no effect.
+    uint16_t& taskResumePoint();
+    void sleepCurrentTask(uint32_t ms);
+    void waitCurrentTaskNotify();
+#endif
+
+#ifdef ARDA_COROUTINES
+    // Suspend the calling coroutine for ms milliseconds without polling: the task
+    // is not dispatched again until then (microsecond tasks are converted).
+    // Returns false with WrongState if not called from a coroutine task. While
+    // asleep, getTaskInterval() still reports the task's own interval, and
+    // setTaskInterval() changes it without ending the sleep.
+    bool sleep(uint32_t ms);
+#endif
+
     // Returns milliseconds since begin() was called, or 0 if not yet begun.
     uint32_t uptime() const;
 
@@ -568,6 +1084,10 @@ private:
     static constexpr uint8_t FLAG_IN_RUN   = 0x02;  // bit 1: currently inside run()
     static constexpr uint8_t FLAG_IN_BEGIN = 0x04;  // bit 2: currently inside begin() task-start loop
 
+    // Deadline heap indices
+    static constexpr uint8_t HEAP_MS = 0;  // Millisecond tasks, timed by clock_
+    static constexpr uint8_t HEAP_US = 1;  // Microsecond tasks, timed by ARDA_MICROS_SOURCE
+
     Task tasks[ARDA_MAX_TASKS];
     int8_t taskCount;        // Total slots used (including deleted) - for iteration bounds
     int8_t activeCount;      // Active (non-deleted) tasks - O(1) query via getTaskCount()
@@ -576,8 +1096,31 @@ private:
     int8_t currentTask;      // ID of currently executing task (-1 if none)
     uint8_t callbackDepth;   // Current callback nesting depth (guards against stack overflow)
     uint8_t flags_;          // Packed flags: bit 0 = begun, bit 1 = inRun
+    uint8_t readyGen_;       // Bumped when a task may become eligible; runInternal() rebuilds its ready masks
+
+    // Ready structures (see schedUpdate_): interval-0 tasks by level, interval tasks by deadline
+    uint8_t everyCycleMask_[ARDA_READY_LEVELS][ARDA_TASK_MASK_BYTES];
+    // Interval tasks wait in one of two heaps by unit (HEAP_MS / HEAP_US)
+    int8_t dueHeap_[2][ARDA_MAX_TASKS];  // Min-heaps of task IDs ordered by lastRun + interval
+    int8_t duePos_[ARDA_MAX_TASKS];      // Heap index per task ID (-1 = not queued)
+    int8_t dueCount_[2];                 // Number of tasks in each heap
+    uint8_t carryMask_[ARDA_TASK_MASK_BYTES];  // Ready tasks cut off by the cycle budget
+    uint8_t ranMask_[ARDA_TASK_MASK_BYTES];    // Tasks that already ran this top-level cycle
+    uint32_t cycleBudgetUs_;             // Max dispatch time per run() in us (0 = unlimited)
+#ifdef ARDA_CHILD_SCHEDULERS
+    uint32_t budgetStartUs_;             // Start of the current top-level cycle's budget
+    Arda* parent_;                       // Scheduler this one is mounted on (nullptr = none)
+#endif
     ArdaError error_;        // Error code from most recent failed operation
 
+    // ISR deferral ring (single producer = ISR, single consumer = run()). Head and
+    // tail are free-running; each side writes only its own index, so no cli().
+    volatile int8_t deferTask_[ARDA_DEFER_QUEUE_SIZE];
+    volatile uint16_t deferPayload_[ARDA_DEFER_QUEUE_SIZE];
+    volatile uint8_t deferHead_;     // Written by producer after filling the slot
+    volatile uint8_t deferTail_;     // Written by consumer after reading the slot
+    volatile uint8_t deferDropped_;  // Items lost to a full ring (saturating)
+
     // User callbacks
 #ifdef ARDA_TASK_RECOVERY
     TimeoutCallback timeoutCallback;            // Called when task exceeds timeout
@@ -587,16 +1130,164 @@ private:
 #endif
     StartFailureCallback startFailureCallback;  // Called when task fails to start in begin()
     TraceCallback traceCallback;                // Called for debug/trace events
+    IdleCallback idleCallback;                  // Called by runOrSleep() when nothing is due
+    DeferHandler deferHandler;                  // Called by run() for each deferred ISR item
+    ClockSource clock_;                         // Time source for all scheduling decisions
+#ifdef ARDA_EDF
+    SchedulerPolicy policy_;                    // Dispatch order (kept across reset)
+#endif
+#if ARDA_MAX_TIMERS > 0
+    // 12 bytes on AVR. due and period stay 32-bit: both accept the full task
+    // interval range (up to ARDA_MAX_INTERVAL), so a 16-bit relative due would
+    // cap timers at ~65s. Pending timers form a list sorted by due time, so
+    // arming, re-arming and cancelling walk it - O(timers), cheap for the small
+    // pools this is meant for - while finding the earliest timer is O(1).
+    struct Timer_ {
+        TimerCallback callback;  // nullptr = free slot
+        uint32_t due;            // Clock tick the timer fires at
+        uint32_t period;         // Re-arm interval (0 = one-shot)
+        int8_t next;             // Next pending timer in due order (-1 = end)
+        uint8_t gen;             // Handle generation, bumped when the slot is freed
+    };
+    Timer_ timers_[ARDA_MAX_TIMERS];
+    int8_t timerHead_;                          // Earliest pending timer (-1 = none)
+#endif
+#if ARDA_MAX_GROUPS > 0
+    uint8_t groupMembers_[ARDA_MAX_GROUPS][ARDA_TASK_MASK_BYTES];  // Member bitmap per group
+    uint8_t heldMask_[ARDA_TASK_MASK_BYTES];    // Members of any paused group (kept out of the ready structures)
+    uint8_t groupPaused_;                       // Bit g = group g paused
+#endif
+#if ARDA_MAX_DEPENDENCIES > 0
+    struct Dependency_ {
+        int8_t before;           // -1 = free slot
+        int8_t after;
+        bool onlyIfRan;          // 'after' is triggered by, and gated on, 'before' running
+    };
+    Dependency_ deps_[ARDA_MAX_DEPENDENCIES];
+    uint8_t depTasks_[ARDA_TASK_MASK_BYTES];    // Tasks with any edge (others skip the edge scan)
+    uint8_t triggeredMask_[ARDA_TASK_MASK_BYTES];  // Released by an onlyIfRan edge this cycle
+#endif
+#ifdef ARDA_NAME_INDEX
+    int8_t nameIndex_[ARDA_NAME_INDEX_SIZE];    // Task ID per hash slot (-1 = empty)
+#endif
+#ifdef ARDA_COROUTINES
+    struct Coroutine_ {
+        ucontext_t ctx;          // Saved context while suspended
+        void* stack;             // Caller-provided stack
+        size_t stackSize;
+        uint32_t savedInterval;  // Task interval to restore when a sleep() ends
+        uint32_t sleepStart;     // Task clock when sleep() was called
+        uint32_t sleepFor;       // Requested sleep in the task's unit
+        int8_t taskId;           // Owning task (-1 = free slot)
+        bool active;             // Suspended mid-body: resume ctx instead of restarting
+        bool sleepPending;       // sleep() called, not yet applied by dispatchTask_()
+        bool sleeping;           // Task interval holds the sleep time (own one in savedInterval)
+    };
+    Coroutine_ coro_[ARDA_MAX_COROUTINES];
+    ucontext_t coroReturn_;      // Scheduler context a suspending coroutine returns to
+    int8_t coroCurrent_;         // Slot executing right now (-1 = on the scheduler stack)
+    uint8_t coroDepth_;          // callbackDepth while that slot's body is on top
+    static Arda* coroSelf_;      // Instance entering a new coroutine (makecontext passes no pointer)
+#endif
+#ifndef ARDA_NO_PRIORITY
+    uint16_t agingStepMs_;                      // Overdue ms per priority boost (0 = off)
+#endif
 
     int8_t allocateSlot();   // Get next free slot from free list, or new slot. Returns -1 if full.
     void freeSlot(int8_t slot);  // Return slot to free list
     void runInternal(int8_t skipTask);  // Internal scheduler loop
+    void drainDeferred_();              // Deliver deferFromISR() items queued before this call
+#if ARDA_MAX_TIMERS > 0
+    TimerHandle addTimer_(TimerCallback callback, uint32_t ms, bool periodic);
+    int8_t timerSlot_(TimerHandle handle) const;  // Slot of a live handle (-1 if stale)
+    void timerInsert_(int8_t slot);     // Link a slot into the pending list by due time
+    void timerUnlink_(int8_t slot);
+    void timerFree_(int8_t slot);
+    void timerClear_();                 // Cancel every timer
+    void runTimers_();                  // Fire the timers that are due
+#endif
+#if ARDA_MAX_GROUPS > 0
+    bool isHeld_(int8_t id) const;      // Bit test in heldMask_
+    void groupRefresh_();               // Rebuild heldMask_ after membership or pause changes
+    void groupClear_();                 // Empty and resume every group
+#endif
+#if ARDA_MAX_DEPENDENCIES > 0
+    bool depPending_(const uint8_t readyMask[][ARDA_TASK_MASK_BYTES], int8_t id) const;  // Still to run this cycle
+    int8_t depResolve_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], int8_t id, int8_t& deferred);
+    int8_t depRelease_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], int8_t id);  // After 'id' ran
+    bool depReaches_(int8_t from, int8_t to) const;  // Path along edges from 'from' to 'to'
+    void depRefresh_();                 // Rebuild depTasks_ after edges change
+    void depClear_();                   // Remove every edge
+#endif
+    void callLoop_(int8_t id);          // Invoke a task's loop(), or resume its coroutine
+    void callTask_(int8_t id, TaskCallback cb);  // Invoke a callback, passing the context if it takes one
+#ifdef ARDA_PROTOTHREADS
+    void ptWake_(int8_t id);            // Undo ARDA_SLEEP / ARDA_AWAIT_NOTIFY scheduling changes
+#endif
+#ifdef ARDA_CHILD_SCHEDULERS
+    static void childBegin_(void* child);  // Mount task setup(): begin() the child once
+    static void childRun_(void* child);    // Mount task loop(): one child run() cycle
+    uint32_t budgetLeftUs_() const;        // Rest of this cycle's budget (UINT32_MAX = none)
+#endif
+#ifdef ARDA_COROUTINES
+    static void coroEntry_();           // First frame on every coroutine stack
+    int8_t coroSlot_(int8_t taskId) const;  // Coroutine slot owned by a task (-1 if none)
+    bool coroInBody_() const;           // Caller is the running coroutine's body
+    void coroResume_(int8_t id);        // Switch into a coroutine until it suspends or returns
+    void coroSuspend_();                // Switch from the current coroutine back to the scheduler
+    void coroApplySleep_(int8_t id);    // Turn a pending sleep() into the task's next deadline
+    void coroRewind_(int8_t id);        // Restart body from the top on next dispatch
+    void coroClear_();                  // Free every coroutine slot
+#endif
+#ifdef ARDA_EDF
+    int8_t takeEarliestDeadline_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], uint32_t now);
+#endif
+    uint32_t dispatchTask_(int8_t id, uint32_t now);  // Run one task's loop(); returns clock after it
+    uint32_t buildReadyMasks_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], int8_t skipTask,
+                              uint32_t now, uint32_t nowUs,
+                              uint32_t& nextDueInUs);  // Returns ms until next queued deadline
+    void collectDue_(uint8_t readyMask[][ARDA_TASK_MASK_BYTES], uint8_t heap, int16_t pos,
+                     uint32_t now, uint32_t& nextDueIn) const;  // Walk the due prefix of a heap
+    uint32_t taskClock_(int8_t id) const;  // Current time in the task's unit
+    bool checkRanThisCycle_(int8_t id) const;        // Task already ran this cycle (ranMask_)
+    void updateRanThisCycle_(int8_t id, bool val);   // Mark/unmark in ranMask_
+    uint8_t readyLevel_(int8_t id, uint32_t elapsed) const;  // Ready level, aged if enabled
+    void advanceLastRun_(int8_t id, uint32_t start);  // Apply the task's TaskTiming after a run
+    bool setIntervalInternal_(int8_t id, uint32_t interval, bool useMicros, bool resetTiming);
+    int8_t autoStartCreated_(int8_t id, bool autoStart);  // Start (or mark) a configured new task
+    void schedUpdate_(int8_t id);     // Re-file a task after a state/timing/priority change
+    void notifyBits_(int8_t id, uint8_t bits);  // notifyTask() body, no checks and no error_
+    void schedClear_();               // Empty all ready structures
+    bool dueBefore_(int8_t a, int8_t b) const;  // Heap order: a's deadline precedes b's
+    int8_t heapSiftUp_(uint8_t heap, int8_t pos);   // Returns final position
+    void heapSiftDown_(uint8_t heap, int8_t pos);
+    void heapRemoveAt_(uint8_t heap, int8_t pos);
     void emitTrace(int8_t taskId, TraceEvent event);  // Invoke trace callback with depth guard
-    int8_t initTaskFields_(int8_t id, TaskCallback setup, TaskCallback loop,
-                           uint32_t intervalMs, TaskCallback teardown, bool autoStart);  // Common task init
+    int8_t initTaskFields_(int8_t id, uint32_t intervalMs, bool autoStart);  // Common task init
+#ifndef ARDA_NO_NAMES
+    bool checkNewName_(const char* name);  // Name usable for a new task? Sets error if not
+#endif
+#ifdef ARDA_TABLE_TASKS
+    int8_t createTableTask_(const ArdaTaskDef* def);  // One createTasks() row, kept in place
+#endif
 
+#ifdef ARDA_FLASH_NAMES
+    // Compare a stored (flash) name 'a' with 'b', which is in flash if bInFlash, else in RAM
+    static bool nameEquals(const char* a, const char* b, bool bInFlash = false);
+    int8_t findTaskByStoredName_(const char* name) const;  // findTaskByName() for a flash query
+#else
     // Case-insensitive string comparison helper (only used if ARDA_CASE_INSENSITIVE_NAMES defined)
     static bool nameEquals(const char* a, const char* b);
+#endif
+#ifdef ARDA_NAME_INDEX
+    // Name -> task ID hash index, probed linearly. Hashing folds case when
+    // ARDA_CASE_INSENSITIVE_NAMES is defined so it agrees with nameEquals().
+    static uint8_t nameHash_(const char* name, bool inFlash);
+    int8_t nameIndexFind_(const char* name, bool inFlash) const;
+    void nameIndexInsert_(int8_t id);   // After the task's name is set
+    void nameIndexRemove_(int8_t id);   // Before the task's name is cleared or replaced
+    void nameIndexClear_();
+#endif
 
 #ifdef ARDA_TASK_RECOVERY
 #if ARDA_TASK_RECOVERY_IMPL
@@ -618,18 +1309,22 @@ private:
 #endif
     void initShell_();                    // Initialize shell task in slot 0
     void shellCmd_(uint8_t len);
-    void shellList_();
+    void shellList_(const Arda& sched, uint8_t depth);  // 'l' output; indents mounted children
 #ifndef ARDA_SHELL_MINIMAL
     void shellInfo_(int8_t id);
     uint32_t shellParseArg2_(uint8_t len);  // Parse second numeric argument from command buffer
 #endif
     friend void ardaShellLoop_();         // Static callback needs access
 #endif
+    template <typename T, uint8_t N> friend class ArdaQueue;  // Wakes consumers via notifyBits_()
 
 #ifdef ARDA_INTERNAL_TEST
 public:
     // Test accessor for internal task state (e.g., overflow testing)
     Task* getTaskPtr_(int8_t id) { return (id >= 0 && id < taskCount) ? &tasks[id] : nullptr; }
+#ifdef ARDA_NAME_INDEX
+    const int8_t* getNameIndex_() const { return nameIndex_; }  // ARDA_NAME_INDEX_SIZE slots
+#endif
 #endif
 };
 
@@ -638,6 +1333,91 @@ public:
 extern Arda OS;
 #endif
 
+// Fixed-capacity FIFO of N items of type T for passing data between tasks.
+// Copying API: tryPush()/tryPop(). Zero-copy API: reserve() a slot, write it in
+// place, then commit(); peek() the front in place, then pop(). Once attached to
+// a consumer task, the queue notifies it (see notifyTask) when it goes from empty
+// to non-empty - pair it with an event task that drains until tryPop() fails.
+// Task context only: like the rest of Arda, NOT interrupt-safe (see deferFromISR).
+template <typename T, uint8_t N>
+class ArdaQueue {
+public:
+    static_assert(N > 0, "ArdaQueue capacity must be at least 1");
+
+    ArdaQueue() : head_(0), count_(0), sched_(nullptr), consumer_(-1), bits_(0) {}
+
+    ArdaQueue(const ArdaQueue&) = delete;
+    ArdaQueue& operator=(const ArdaQueue&) = delete;
+
+    // Wake consumerTaskId with 'bits' whenever the queue becomes non-empty.
+    void attach(Arda& sched, int8_t consumerTaskId, uint8_t bits = ARDA_NOTIFY_QUEUE) {
+        sched_ = &sched;
+        consumer_ = consumerTaskId;
+        bits_ = bits & ARDA_NOTIFY_MASK;
+    }
+    void detach() { sched_ = nullptr; consumer_ = -1; }
+
+    // Copy item in. Returns false if full.
+    bool tryPush(const T& item) {
+        T* slot = reserve();
+        if (slot == nullptr) return false;
+        *slot = item;
+        commit();
+        return true;
+    }
+
+    // Copy the front item out and remove it. Returns false if empty.
+    bool tryPop(T& out) {
+        if (count_ == 0) return false;
+        out = buf_[head_];
+        pop();
+        return true;
+    }
+
+    // Slot after the last item, or nullptr if full. Nothing is visible to the
+    // consumer until commit(); reserving again before commit returns the same slot.
+    T* reserve() {
+        if (count_ >= N) return nullptr;
+        uint8_t tail = (uint8_t)((head_ + count_) % N);
+        return &buf_[tail];
+    }
+
+    // Publish the slot returned by reserve(). No-op if the queue is full. A
+    // consumer that was deleted since attach() is skipped, leaving the scheduler's
+    // error state untouched.
+    void commit() {
+        if (count_ >= N) return;
+        count_++;
+        if (count_ == 1 && sched_ != nullptr && sched_->isValidTask(consumer_)) {
+            sched_->notifyBits_(consumer_, bits_);
+        }
+    }
+
+    // Front item in place (nullptr if empty). Valid until pop().
+    T* peek() { return count_ ? &buf_[head_] : nullptr; }
+
+    // Remove the front item. Returns false if empty.
+    bool pop() {
+        if (count_ == 0) return false;
+        head_ = (uint8_t)((head_ + 1) % N);
+        count_--;
+        return true;
+    }
+
+    uint8_t size() const { return count_; }
+    bool isEmpty() const { return count_ == 0; }
+    bool isFull() const { return count_ >= N; }
+    static constexpr uint8_t capacity() { return N; }
+
+private:
+    T buf_[N];
+    uint8_t head_;       // Index of the front item
+    uint8_t count_;      // Committed items
+    Arda* sched_;        // Scheduler to notify (nullptr = not attached)
+    int8_t consumer_;    // Task woken on empty -> non-empty
+    uint8_t bits_;       // Notification bits for the consumer
+};
+
 // Macro helpers for defining tasks
 #define TASK_SETUP(name) void name##_setup()
 #define TASK_LOOP(name) void name##_loop()
@@ -661,6 +1441,59 @@ extern Arda OS;
 #endif
 #endif
 
+#ifdef ARDA_PROTOTHREADS
+// Stackless protothreads: write a task's loop as straight-line code that waits.
+// The resume point lives in the task, so locals do NOT survive a wait - keep
+// state in statics/globals. Use at most one wait macro per source line.
+//
+//   TASK_LOOP(blink) {
+//       ARDA_TASK_BEGIN();
+//       digitalWrite(LED, HIGH);
+//       ARDA_SLEEP(100);                // Not dispatched for 100ms
+//       digitalWrite(LED, LOW);
+//       ARDA_AWAIT(buttonPressed());    // Polled at the task's interval
+//       ARDA_AWAIT_NOTIFY();            // Not dispatched until notifyTask()
+//       ARDA_TASK_END();                // Next dispatch starts from the top
+//   }
+#if defined(__has_attribute)
+#if __has_attribute(fallthrough)
+#define ARDA_PT_FALLTHROUGH_ __attribute__((fallthrough))
+#endif
+#endif
+#ifndef ARDA_PT_FALLTHROUGH_
+#define ARDA_PT_FALLTHROUGH_ ((void)0)
+#endif
+#define ARDA_TASK_BEGIN_ON(scheduler) \
+    Arda& ardaPtOs_ = (scheduler); \
+    uint16_t& ardaPtLc_ = ardaPtOs_.taskResumePoint(); \
+    switch (ardaPtLc_) { case 0:
+#define ARDA_AWAIT(cond) \
+    do { ardaPtLc_ = __LINE__; ARDA_PT_FALLTHROUGH_; case __LINE__: \
+        if (!(cond)) return; } while (0)
+#define ARDA_SLEEP(ms) \
+    do { ardaPtLc_ = __LINE__; ardaPtOs_.sleepCurrentTask(ms); return; case __LINE__:; } while (0)
+#define ARDA_AWAIT_NOTIFY() \
+    do { ardaPtLc_ = __LINE__; ARDA_PT_FALLTHROUGH_; case __LINE__: \
+        if (ardaPtOs_.getTaskNotification(ardaPtOs_.getCurrentTask()) == 0) { \
+            ardaPtOs_.waitCurrentTaskNotify(); return; } } while (0)
+#define ARDA_TASK_END() } ardaPtLc_ = 0
+#ifndef ARDA_NO_GLOBAL_INSTANCE
+#define ARDA_TASK_BEGIN() ARDA_TASK_BEGIN_ON(OS)
+#endif
+#endif
+
+// Static task tables: the whole task set as a const array (in flash on AVR),
+// registered with one createTasks() call instead of a createTask() per task:
+//   ARDA_STATIC_TASKS(appTasks,
+//       ARDA_TASK_DEF("blink", nullptr, blinkLoop, 500),
+//       ARDA_TASK_DEF_FULL("ctrl", ctrlSetup, ctrlLoop, 10, ctrlStop, TaskPriority::High));
+//   OS.createTasks(appTasks);
+#define ARDA_STATIC_TASKS(var, ...) const ArdaTaskDef var[] ARDA_PROGMEM = {__VA_ARGS__}
+#define ARDA_TASK_DEF(name, setup, loop, interval) \
+    {name, setup, loop, nullptr, interval, 2 /* TaskPriority::Normal */}
+#define ARDA_TASK_DEF_FULL(name, setup, loop, interval, teardown, priority) \
+    {name, setup, loop, teardown, interval, (uint8_t)(priority)}
+
 // Variants that accept a scheduler parameter (work with or without global instance)
 #ifdef ARDA_NO_NAMES
 #define REGISTER_TASK_ON(scheduler, name, interval) (scheduler).createTask(name##_setup, name##_loop, interval)
@@ -555,6 +555,748 @@ void test_millis_ovrflow_uptime() {
 }
 
 
+// Deadline queue: several interval tasks straddling millis() wraparound each run
+// exactly when their own interval elapses, whatever their creation order
+static int deadlineRuns[4] = {0, 0, 0, 0};
+void deadline0_loop() { deadlineRuns[0]++; }
+void deadline1_loop() { deadlineRuns[1]++; }
+void deadline2_loop() { deadlineRuns[2]++; }
+void deadline3_loop() { deadlineRuns[3]++; }
+
+void test_deadline_queue_mixed_intervals() {
+    printf("Test: deadline queue orders mixed intervals across ovrflow... ");
+    resetTestCounters();
+    for (int k = 0; k < 4; k++) deadlineRuns[k] = 0;
+
+    Arda os;
+    setMockMillis(4294967000UL);  // 296ms before ovrflow
+    os.createTask("d400", nullptr, deadline0_loop, 400);
+    os.createTask("d100", nullptr, deadline1_loop, 100);
+    os.createTask("d0", nullptr, deadline2_loop, 0);
+    os.createTask("d250", nullptr, deadline3_loop, 250);
+    os.begin();
+
+    // Step 50ms at a time for 1000ms (wraps at +296ms)
+    for (int step = 1; step <= 20; step++) {
+        advanceMockMillis(50);
+        os.run();
+    }
+    assert(deadlineRuns[0] == 2);   // 400, 800
+    assert(deadlineRuns[1] == 10);  // every 100
+    assert(deadlineRuns[2] == 20);  // every cycle
+    assert(deadlineRuns[3] == 4);   // 250, 500, 750, 1000
+
+    printf("PASSED\n");
+}
+
+void test_deadline_queue_follows_interval_and_pause() {
+    printf("Test: deadline queue tracks setTaskInterval and pause/resume... ");
+    resetTestCounters();
+
+    Arda os;
+    int8_t id = os.createTask("task", task1_setup, task1_loop, 1000);
+    os.begin();
+
+    // Shortening the interval without resetting timing makes the task due sooner
+    setMockMillis(300);
+    os.run();
+    assert(loop1Called == 0);
+    assert(os.setTaskInterval(id, 200));
+    os.run();
+    assert(loop1Called == 1);  // 300 - 0 >= 200
+
+    // Paused tasks leave the queue; resuming keeps the original lastRun
+    os.pauseTask(id);
+    setMockMillis(600);
+    os.run();
+    assert(loop1Called == 1);
+    os.resumeTask(id);
+    os.run();
+    assert(loop1Called == 2);  // 600 - 300 >= 200
+
+    // Switching between interval and every-cycle moves the task between structures
+    os.setTaskInterval(id, 0);
+    os.run();
+    assert(loop1Called == 3);
+    os.setTaskInterval(id, 500, true);
+    os.run();
+    assert(loop1Called == 3);
+    setMockMillis(1100);
+    os.run();
+    assert(loop1Called == 4);
+
+    printf("PASSED\n");
+}
+
+void test_interval_above_max_rejected() {
+    printf("Test: intervals above ARDA_MAX_INTERVAL are rejected... ");
+    resetTestCounters();
+
+    Arda os;
+    assert(os.createTask("big", task1_setup, task1_loop, ARDA_MAX_INTERVAL + 1) == -1);
+    assert(os.getError() == ArdaError::InvalidValue);
+
+    int8_t id = os.createTask("max", task1_setup, task1_loop, ARDA_MAX_INTERVAL);
+    assert(id >= 0);
+    assert(!os.setTaskInterval(id, 0xFFFFFFFFUL));
+    assert(os.getError() == ArdaError::InvalidValue);
+    assert(os.getTaskInterval(id) == ARDA_MAX_INTERVAL);
+
+    printf("PASSED\n");
+}
+
+// Tickless idle: msUntilNextDue() / runOrSleep()
+static int idleCalls = 0;
+static uint32_t lastIdleMs = 0;
+void recordIdle(uint32_t idleMs) {
+    idleCalls++;
+    lastIdleMs = idleMs;
+    advanceMockMillis(idleMs);  // "Sleep" until the next deadline
+}
+
+void test_ms_until_next_due() {
+    printf("Test: msUntilNextDue reports time to the earliest deadline... ");
+    resetTestCounters();
+
+    Arda os;
+    int8_t slow = os.createTask("slow", task1_setup, task1_loop, 500);
+    int8_t fast = os.createTask("fast", task2_setup, task2_loop, 200);
+    assert(os.msUntilNextDue() == UINT32_MAX);  // Not begun
+
+    os.begin();
+    assert(os.msUntilNextDue() == 200);
+    setMockMillis(150);
+    assert(os.msUntilNextDue() == 50);
+    setMockMillis(250);
+    assert(os.msUntilNextDue() == 0);  // fast is overdue
+    os.run();
+    assert(os.msUntilNextDue() == 200);  // fast re-armed at 250 -> 450; slow due at 500
+
+    // Interval-0 tasks are always ready; paused/stopped tasks are ignored
+    os.setTaskInterval(fast, 0);
+    assert(os.msUntilNextDue() == 0);
+    os.pauseTask(fast);
+    assert(os.msUntilNextDue() == 250);
+    os.stopTask(slow);
+    assert(os.msUntilNextDue() == UINT32_MAX);
+
+    printf("PASSED\n");
+}
+
+void test_run_or_sleep_calls_idle_callback() {
+    printf("Test: runOrSleep passes idle time to idle callback... ");
+    resetTestCounters();
+    idleCalls = 0;
+    lastIdleMs = 0;
+
+    Arda os;
+    assert(!os.runOrSleep());  // Not begun
+    assert(os.getError() == ArdaError::WrongState);
+
+    os.createTask("task", task1_setup, task1_loop, 100);
+    os.setIdleCallback(recordIdle);
+    os.begin();
+
+    assert(os.runOrSleep());
+    assert(loop1Called == 0);
+    assert(idleCalls == 1 && lastIdleMs == 100);
+
+    // Callback advanced the clock to the deadline: next call runs the task
+    assert(os.runOrSleep());
+    assert(loop1Called == 1);
+    assert(idleCalls == 2 && lastIdleMs == 100);
+
+    // reset() without preserveCallbacks clears the idle callback
+    os.reset();
+    os.createTask("task", task1_setup, task1_loop, 100);
+    os.begin();
+    os.runOrSleep();
+    assert(idleCalls == 2);
+
+    printf("PASSED\n");
+}
+
+void test_run_or_sleep_skips_idle_when_ready() {
+    printf("Test: runOrSleep does not idle while a task is ready... ");
+    resetTestCounters();
+    idleCalls = 0;
+
+    Arda os;
+    os.createTask("busy", task1_setup, task1_loop, 0);
+    os.setIdleCallback(recordIdle);
+    os.begin();
+    os.runOrSleep();
+    os.runOrSleep();
+    assert(loop1Called == 2);
+    assert(idleCalls == 0);
+
+    printf("PASSED\n");
+}
+
+static uint32_t virtualTime = 0;
+static uint16_t clockReads = 0;
+uint32_t virtualClock() {
+    clockReads++;
+    return virtualTime;
+}
+
+void test_clock_source_virtual() {
+    printf("Test: injected clock drives intervals and uptime... ");
+    resetTestCounters();
+    setMockMillis(5000);  // Must be ignored by the injected clock
+    virtualTime = 100;
+
+    Arda os(virtualClock);
+    os.createTask("t", task1_setup, task1_loop, 50);
+    os.begin();
+    assert(os.uptime() == 0);
+
+    os.run();
+    assert(loop1Called == 0);   // Waits one interval from start
+    advanceMockMillis(1000);    // Real time moves, virtual clock does not
+    os.run();
+    assert(loop1Called == 0);
+
+    virtualTime = 150;
+    os.run();
+    assert(loop1Called == 1);
+    assert(os.getTaskLastRun(0) == 150);
+    assert(os.uptime() == 50);
+    assert(os.msUntilNextDue() == 50);
+
+    printf("PASSED\n");
+}
+
+void test_clock_read_once_per_dispatch() {
+    printf("Test: clock read once per dispatch decision... ");
+    resetTestCounters();
+    virtualTime = 0;
+
+    Arda os(virtualClock);
+    os.createTask("a", task1_setup, task1_loop, 0);
+    os.createTask("b", task2_setup, task2_loop, 0);
+    os.begin();
+
+    clockReads = 0;
+    os.run();
+    assert(loop1Called == 1 && loop2Called == 1);
+    assert(clockReads == 3);  // One at cycle start, one after each loop()
+
+    printf("PASSED\n");
+}
+
+void test_set_clock_source() {
+    printf("Test: setClockSource before/after begin... ");
+    resetTestCounters();
+    setMockMillis(1000);
+    virtualTime = 7;
+
+    Arda os;
+    assert(os.setClockSource(virtualClock) == true);
+    os.createTask("t", task1_setup, task1_loop, 10);
+    os.begin();
+    assert(os.getTaskLastRun(0) == 0);
+    virtualTime = 17;
+    os.run();
+    assert(os.getTaskLastRun(0) == 17);
+
+    // Swapping clocks mid-run would mix units in lastRun
+    assert(os.setClockSource(nullptr) == false);
+    assert(os.getError() == ArdaError::AlreadyBegun);
+
+    // Clock survives reset(); nullptr restores millis()
+    os.reset();
+    assert(os.setClockSource(nullptr) == true);
+    os.begin();
+    assert(os.uptime() == 0);
+    advanceMockMillis(25);
+    assert(os.uptime() == 25);
+
+    printf("PASSED\n");
+}
+
+void test_micros_interval_task() {
+    printf("Test: microsecond interval task... ");
+    resetTestCounters();
+
+    Arda os;
+    int8_t id = os.createTaskMicros("fast", task1_setup, task1_loop, 2500);
+    assert(id >= 0);
+    assert(os.isTaskMicros(id));
+    assert(os.getTaskInterval(id) == 2500);
+    os.begin();
+    assert(os.getTaskLastRun(id) == 0);
+
+    advanceMockMillis(2);  // 2000us < 2500us
+    os.run();
+    assert(loop1Called == 0);
+    assert(os.msUntilNextDue() == 0);  // 500us left rounds down to 0ms
+
+    advanceMockMillis(1);  // 3000us
+    os.run();
+    assert(loop1Called == 1);
+    assert(os.getTaskLastRun(id) == 3000);
+    assert(os.msUntilNextDue() == 2);  // 2500us rounds down
+
+    // Above the cap in microseconds too
+    assert(os.createTaskMicros("big", nullptr, task2_loop, ARDA_MAX_INTERVAL + 1) == -1);
+    assert(os.getError() == ArdaError::InvalidValue);
+
+    printf("PASSED\n");
+}
+
+void test_micros_interval_wraparound() {
+    printf("Test: microsecond interval across micros() wraparound... ");
+    resetTestCounters();
+    setMockMillis(4294967);  // micros() = 4294967000, 296us before 2^32
+
+    Arda os;
+    int8_t id = os.createTaskMicros("fast", task1_setup, task1_loop, 2000);
+    os.begin();
+
+    advanceMockMillis(1);  // micros() wrapped to 704, 1000us elapsed
+    os.run();
+    assert(loop1Called == 0);
+
+    advanceMockMillis(1);  // 2000us elapsed
+    os.run();
+    assert(loop1Called == 1);
+    assert(os.getTaskLastRun(id) == 1704);
+
+    printf("PASSED\n");
+}
+
+void test_set_task_interval_switches_unit() {
+    printf("Test: setTaskIntervalMicros/setTaskInterval switch unit... ");
+    resetTestCounters();
+
+    Arda os;
+    int8_t ms = os.createTask("ms", task1_setup, task1_loop, 10);
+    int8_t other = os.createTask("other", task2_setup, task2_loop, 100);
+    os.begin();
+
+    advanceMockMillis(4);
+    assert(os.setTaskIntervalMicros(ms, 5000));  // 4ms elapsed carries over as 4000us
+    assert(os.isTaskMicros(ms));
+    assert(!os.isTaskMicros(other));
+    assert(os.getTaskLastRun(ms) == 0);
+    os.run();
+    assert(loop1Called == 0);
+    advanceMockMillis(1);
+    os.run();
+    assert(loop1Called == 1);
+    assert(os.getTaskLastRun(ms) == 5000);
+
+    // Back to milliseconds: 2000us elapsed becomes 2ms
+    advanceMockMillis(2);
+    assert(os.setTaskInterval(ms, 3));
+    assert(!os.isTaskMicros(ms));
+    assert(os.getTaskLastRun(ms) == 5);
+    advanceMockMillis(1);
+    os.run();
+    assert(loop1Called == 2);
+    assert(loop2Called == 0);
+
+    advanceMockMillis(100);
+    os.run();
+    assert(loop2Called == 1);
+
+    printf("PASSED\n");
+}
+
+static int eventLoopCalls = 0;
+static uint8_t eventLastBits = 0;
+static int8_t eventTargetId = -1;
+void eventTaking_loop() {
+    eventLoopCalls++;
+    eventLastBits = OS.takeNotification();
+}
+void eventKeeping_loop() {
+    eventLoopCalls++;
+}
+void eventNotifier_loop() {
+    OS.notifyTask(eventTargetId, 0x01);
+}
+
+void test_event_task_runs_only_when_notified() {
+    printf("Test: event task runs only when notified... ");
+    resetTestCounters();
+    eventLoopCalls = 0;
+    eventLastBits = 0;
+
+    int8_t id = OS.createEventTask("evt", nullptr, eventTaking_loop);
+    assert(id >= 0);
+    assert(OS.isTaskEventMode(id));
+    OS.begin();
+
+    for (int i = 0; i < 5; i++) OS.run();
+    assert(eventLoopCalls == 0);
+    assert(OS.msUntilNextDue() == UINT32_MAX);  // Sleeping event task is not scheduled
+
+    assert(OS.notifyTask(id, 0x05));
+    assert(OS.notifyTask(id, 0x02));
+    assert(OS.getTaskNotification(id) == 0x07);
+    OS.run();
+    assert(eventLoopCalls == 1);
+    assert(eventLastBits == 0x07);
+    assert(OS.getTaskNotification(id) == 0);
+
+    OS.run();
+    OS.run();
+    assert(eventLoopCalls == 1);  // Taken - asleep again
+
+    printf("PASSED\n");
+}
+
+void test_event_task_stays_ready_until_taken() {
+    printf("Test: event task stays ready until notification taken... ");
+    resetTestCounters();
+    eventLoopCalls = 0;
+
+    int8_t id = OS.createEventTask("evt", nullptr, eventKeeping_loop);
+    OS.begin();
+    OS.notifyTask(id, 0x10);
+    OS.run();
+    OS.run();
+    assert(eventLoopCalls == 2);
+    assert(OS.getTaskNotification(id) == 0x10);
+
+    // Leaving event mode makes it a normal interval-0 task; re-entering puts it back to sleep
+    assert(OS.setTaskEventMode(id, false));
+    assert(!OS.isTaskEventMode(id));
+    OS.run();
+    assert(eventLoopCalls == 3);
+
+    printf("PASSED\n");
+}
+
+void test_event_task_interval_timeout() {
+    printf("Test: event task with interval runs on timeout... ");
+    resetTestCounters();
+    eventLoopCalls = 0;
+
+    int8_t id = OS.createEventTask("evt", nullptr, eventTaking_loop, 100);
+    OS.begin();
+    advanceMockMillis(50);
+    OS.run();
+    assert(eventLoopCalls == 0);
+
+    OS.notifyTask(id, 0x01);  // Notification wakes it early
+    OS.run();
+    assert(eventLoopCalls == 1);
+    assert(OS.getTaskLastRun(id) == 50);
+
+    advanceMockMillis(100);   // No notification: interval acts as a timeout
+    OS.run();
+    assert(eventLoopCalls == 2);
+    assert(eventLastBits == 0);
+
+    printf("PASSED\n");
+}
+
+void test_notify_task_errors_and_non_event_tasks() {
+    printf("Test: notifyTask validation and non-event tasks... ");
+    resetTestCounters();
+
+    int8_t id = OS.createTask("plain", task1_setup, task1_loop, 1000);
+    OS.begin();
+
+    assert(!OS.notifyTask(99, 0x01));
+    assert(OS.getError() == ArdaError::InvalidId);
+    assert(!OS.notifyTask(id, 0));
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(!OS.notifyTask(id, 0x80));
+    assert(OS.getError() == ArdaError::InvalidValue);
+
+    // Bits accumulate on a normal task but do not wake it
+    assert(OS.notifyTask(id, 0x03));
+    OS.run();
+    assert(loop1Called == 0);
+    assert(OS.getTaskNotification(id) == 0x03);
+    assert(OS.takeNotification() == 0);  // Outside a task
+
+    printf("PASSED\n");
+}
+
+void test_notify_wakes_event_task_same_cycle() {
+    printf("Test: notification from earlier task wakes event task same cycle... ");
+    resetTestCounters();
+    eventLoopCalls = 0;
+
+    OS.createTask("notifier", nullptr, eventNotifier_loop, 0);
+    eventTargetId = OS.createEventTask("evt", nullptr, eventTaking_loop);
+    OS.begin();
+
+    OS.run();
+    assert(eventLoopCalls == 1);
+    OS.run();
+    assert(eventLoopCalls == 2);
+
+    printf("PASSED\n");
+}
+
+static int8_t deferSeenTask[16];
+static uint16_t deferSeenPayload[16];
+static uint8_t deferSeenCount = 0;
+void recordDefer(int8_t taskId, uint16_t payload) {
+    deferSeenTask[deferSeenCount] = taskId;
+    deferSeenPayload[deferSeenCount] = payload;
+    deferSeenCount++;
+}
+void requeueDefer(int8_t taskId, uint16_t payload) {
+    recordDefer(taskId, payload);
+    OS.deferFromISR(taskId, payload + 1);  // Must wait for the next run()
+}
+
+void test_defer_wakes_event_task() {
+    printf("Test: deferFromISR wakes event task on next run... ");
+    resetTestCounters();
+    eventLoopCalls = 0;
+    eventLastBits = 0;
+
+    int8_t id = OS.createEventTask("rx", nullptr, eventTaking_loop);
+    OS.begin();
+    OS.run();
+    assert(eventLoopCalls == 0);
+
+    assert(OS.deferFromISR(id));
+    assert(OS.deferFromISR(id));          // Coalesces into the same bit
+    assert(OS.msUntilNextDue() == 0);     // Pending ISR work keeps runOrSleep awake
+    OS.run();
+    assert(eventLoopCalls == 1);
+    assert(eventLastBits == ARDA_NOTIFY_DEFER);
+    assert(OS.msUntilNextDue() == UINT32_MAX);
+
+    assert(OS.deferFromISR(99));  // Stale ID: dropped at drain without error
+    OS.run();
+    assert(OS.getError() == ArdaError::Ok);
+
+    printf("PASSED\n");
+}
+
+void test_defer_handler_in_order_and_bounded() {
+    printf("Test: defer handler gets items in order, drain is bounded... ");
+    resetTestCounters();
+    deferSeenCount = 0;
+
+    OS.setDeferHandler(recordDefer);
+    OS.begin();
+    for (uint16_t i = 0; i < ARDA_DEFER_QUEUE_SIZE; i++) {
+        assert(OS.deferFromISR((int8_t)i, (uint16_t)(1000 + i)));
+    }
+    assert(!OS.deferFromISR(0, 9999));  // Full
+    assert(OS.getDeferDropCount() == 1);
+    OS.run();
+    assert(deferSeenCount == ARDA_DEFER_QUEUE_SIZE);
+    for (uint8_t i = 0; i < ARDA_DEFER_QUEUE_SIZE; i++) {
+        assert(deferSeenTask[i] == (int8_t)i);
+        assert(deferSeenPayload[i] == 1000 + i);
+    }
+
+    // Items queued while draining are left for the next run()
+    deferSeenCount = 0;
+    OS.setDeferHandler(requeueDefer);
+    OS.deferFromISR(3, 7);
+    OS.run();
+    assert(deferSeenCount == 1);
+    OS.run();
+    assert(deferSeenCount == 2);
+    assert(deferSeenPayload[1] == 8);
+
+    // reset() discards queued items and the drop count
+    OS.reset();
+    OS.setDeferHandler(recordDefer);
+    deferSeenCount = 0;
+    OS.begin();
+    OS.run();
+    assert(deferSeenCount == 0);
+    assert(OS.getDeferDropCount() == 0);
+
+    printf("PASSED\n");
+}
+
+struct Sample { uint16_t raw; uint8_t seq; };
+static ArdaQueue<Sample, 4> sampleQueue;
+static ArdaQueue<uint16_t, 2> filteredQueue;
+static uint8_t sampleSeq = 0;
+static int filterRuns = 0;
+static int publishRuns = 0;
+static uint16_t publishedSum = 0;
+
+void sampler_loop() {
+    Sample* slot = sampleQueue.reserve();  // Write in place
+    if (slot) {
+        slot->raw = (uint16_t)(sampleSeq * 10);
+        slot->seq = sampleSeq++;
+        sampleQueue.commit();
+    }
+}
+void filter_loop() {
+    filterRuns++;
+    OS.takeNotification();
+    while (Sample* s = sampleQueue.peek()) {
+        if (!filteredQueue.tryPush((uint16_t)(s->raw + 1))) break;  // Downstream full - retry later
+        sampleQueue.pop();
+    }
+}
+void publish_loop() {
+    publishRuns++;
+    OS.takeNotification();
+    uint16_t v;
+    while (filteredQueue.tryPop(v)) publishedSum += v;
+}
+
+void test_queue_basic_fifo() {
+    printf("Test: ArdaQueue FIFO, full/empty and wraparound... ");
+    ArdaQueue<int, 3> q;
+    int v = 0;
+    assert(q.isEmpty() && q.capacity() == 3);
+    assert(!q.tryPop(v));
+    assert(q.peek() == nullptr);
+    assert(q.tryPush(1) && q.tryPush(2) && q.tryPush(3));
+    assert(q.isFull());
+    assert(!q.tryPush(4));
+    assert(q.reserve() == nullptr);
+    assert(q.tryPop(v) && v == 1);
+    assert(q.tryPush(4));  // Wraps around
+    int expect[] = {2, 3, 4};
+    for (int i = 0; i < 3; i++) {
+        assert(*q.peek() == expect[i]);
+        assert(q.pop());
+    }
+    assert(q.isEmpty() && !q.pop());
+
+    // Reserved slot is invisible until commit
+    int* slot = q.reserve();
+    *slot = 42;
+    assert(q.size() == 0);
+    assert(q.reserve() == slot);
+    q.commit();
+    assert(q.size() == 1 && q.tryPop(v) && v == 42);
+
+    printf("PASSED\n");
+}
+
+void test_queue_pipeline_wakes_consumers() {
+    printf("Test: ArdaQueue pipeline wakes consumers only when data moves... ");
+    resetTestCounters();
+    sampleSeq = 0;
+    filterRuns = 0;
+    publishRuns = 0;
+    publishedSum = 0;
+    while (sampleQueue.pop()) {}
+    while (filteredQueue.pop()) {}
+
+    OS.createTask("sample", nullptr, sampler_loop, 100);
+    int8_t filter = OS.createEventTask("filter", nullptr, filter_loop);
+    int8_t publish = OS.createEventTask("publish", nullptr, publish_loop);
+    sampleQueue.attach(OS, filter);
+    filteredQueue.attach(OS, publish);
+    OS.begin();
+
+    for (int i = 0; i < 5; i++) OS.run();
+    assert(filterRuns == 0 && publishRuns == 0);  // No data, no wakeups
+
+    advanceMockMillis(100);
+    OS.run();  // sample -> filter -> publish in one cycle (ID order)
+    assert(filterRuns == 1 && publishRuns == 1);
+    assert(publishedSum == 1);
+    OS.run();
+    assert(filterRuns == 1 && publishRuns == 1);
+
+    advanceMockMillis(100);
+    OS.run();
+    assert(publishedSum == 1 + 11);
+    assert(OS.getTaskNotification(filter) == 0);
+
+    sampleQueue.detach();
+    filteredQueue.detach();
+    printf("PASSED\n");
+}
+
+void test_queue_stale_consumer_keeps_error() {
+    printf("Test: ArdaQueue commit to a deleted consumer leaves error alone... ");
+    resetTestCounters();
+
+    Arda os;
+    ArdaQueue<int, 2> q;
+    int8_t consumer = os.createEventTask("cons", nullptr, task1_loop);
+    q.attach(os, consumer);
+    assert(os.deleteTask(consumer));
+
+    assert(!os.pauseTask(consumer));  // Leave an unrelated error behind
+    assert(os.getError() == ArdaError::InvalidId);
+    assert(q.tryPush(1));
+    assert(os.getError() == ArdaError::InvalidId);  // Not set or cleared by the queue
+
+    // A live consumer is still woken without touching the error either
+    while (q.pop()) {}
+    int8_t live = os.createEventTask("live", nullptr, task1_loop);
+    assert(!os.pauseTask(-1));
+    q.attach(os, live);
+    assert(q.tryPush(2));
+    assert(os.getTaskNotification(live) == ARDA_NOTIFY_QUEUE);
+    assert(os.getError() == ArdaError::InvalidId);
+
+    printf("PASSED\n");
+}
+
+void test_task_timing_fixed_rate_no_drift() {
+    printf("Test: FixedRate timing keeps exact count, FixedDelay drifts... ");
+    resetTestCounters();
+
+    Arda os;
+    int8_t delay = os.createTask("delay", task1_setup, task1_loop, 10);
+    int8_t rate = os.createTask("rate", task2_setup, task2_loop, 10);
+    assert(os.getTaskTiming(delay) == TaskTiming::FixedDelay);
+    assert(os.setTaskTiming(rate, TaskTiming::FixedRate));
+    assert(os.getTaskTiming(rate) == TaskTiming::FixedRate);
+    os.begin();
+
+    // Poll every 3ms: each run is up to 2ms late
+    for (int t = 0; t < 1200; t += 3) {
+        advanceMockMillis(3);
+        os.run();
+    }
+    assert(loop2Called == 120);     // One run per 10ms slot
+    assert(loop1Called == 100);     // Lateness accumulates: one run per 12ms
+    assert(os.getTaskLastRun(rate) % 10 == 0);  // lastRun stays on the grid
+
+    printf("PASSED\n");
+}
+
+void test_task_timing_catch_up() {
+    printf("Test: CatchUp timing makes up missed slots, bounded... ");
+    resetTestCounters();
+
+    Arda os;
+    int8_t rate = os.createTask("rate", task1_setup, task1_loop, 10);
+    int8_t burst = os.createTask("burst", task2_setup, task2_loop, 10);
+    os.setTaskTiming(rate, TaskTiming::FixedRate);
+    os.setTaskTiming(burst, TaskTiming::CatchUp);
+    os.begin();
+
+    advanceMockMillis(35);  // Slots 10, 20, 30 all missed
+    for (int i = 0; i < 5; i++) os.run();
+    assert(loop1Called == 1);   // FixedRate skips to the latest slot
+    assert(loop2Called == 3);   // CatchUp runs once per cycle until caught up
+    assert(os.getTaskLastRun(rate) == 30);
+    assert(os.getTaskLastRun(burst) == 30);
+
+    // Far behind: more than ARDA_MAX_CATCHUP slots owed -> skip ahead
+    advanceMockMillis(1000);   // t=1035
+    for (int i = 0; i < 5; i++) os.run();
+    assert(loop2Called == 4);
+    assert(os.getTaskLastRun(burst) == 1030);
+
+    assert(!os.setTaskTiming(burst, static_cast<TaskTiming>(7)));
+    assert(os.getError() == ArdaError::InvalidValue);
+    assert(!os.setTaskTiming(99, TaskTiming::FixedRate));
+    assert(os.getError() == ArdaError::InvalidId);
+
+    printf("PASSED\n");
+}
+
 void test_delete_task() {
     printf("Test: delete task... ");
     resetTestCounters();
@@ -5392,6 +6134,140 @@ void test_priority_autostart_before_begin() {
     printf("PASSED\n");
 }
 
+// Ready-bitmap scheduling: mixed priorities across many slots dispatch highest
+// level first, lowest ID first within a level
+static int8_t bitmapOrder[ARDA_MAX_TASKS];
+static int bitmapOrderIndex = 0;
+
+void bitmapOrder_loop() {
+    if (bitmapOrderIndex < ARDA_MAX_TASKS) {
+        bitmapOrder[bitmapOrderIndex++] = OS.getCurrentTask();
+    }
+}
+
+void test_priority_bitmap_order_many_tasks() {
+    printf("Test: ready bitmaps dispatch by level then ID... ");
+    resetTestCounters();
+    bitmapOrderIndex = 0;
+
+    // Priorities cycle Lowest..Highest across all slots
+    char name[8];
+    for (int8_t i = 0; i < ARDA_MAX_TASKS; i++) {
+        snprintf(name, sizeof(name), "b%d", i);
+        int8_t id = OS.createTask(name, nullptr, bitmapOrder_loop, 0, nullptr, true,
+                                  static_cast<TaskPriority>(i % 5));
+        assert(id == i);
+    }
+    OS.begin();
+    OS.run();
+
+    assert(bitmapOrderIndex == ARDA_MAX_TASKS);
+    for (int k = 1; k < bitmapOrderIndex; k++) {
+        uint8_t prevPri = static_cast<uint8_t>(OS.getTaskPriority(bitmapOrder[k - 1]));
+        uint8_t curPri = static_cast<uint8_t>(OS.getTaskPriority(bitmapOrder[k]));
+        assert(prevPri >= curPri);
+        if (prevPri == curPri) assert(bitmapOrder[k - 1] < bitmapOrder[k]);
+    }
+
+    printf("PASSED\n");
+}
+
+// Mid-cycle changes made by a running task must be visible to the same cycle
+static int8_t midCycleTargetId = -1;
+static int midCycleTargetRuns = 0;
+static bool midCycleTargetRanBeforeMid = false;
+static int midCycleMidRuns = 0;
+
+void midCycleResumer_loop() {
+    OS.resumeTask(midCycleTargetId);
+    OS.setTaskPriority(midCycleTargetId, TaskPriority::Highest);
+}
+void midCycleTarget_loop() {
+    midCycleTargetRuns++;
+    if (midCycleMidRuns == 0) midCycleTargetRanBeforeMid = true;
+}
+void midCycleMid_loop() { midCycleMidRuns++; }
+
+void test_priority_bitmap_sees_mid_cycle_resume() {
+    printf("Test: task resumed and promoted mid-cycle runs in same cycle... ");
+    resetTestCounters();
+    midCycleTargetRuns = 0;
+    midCycleMidRuns = 0;
+    midCycleTargetRanBeforeMid = false;
+
+    (void)OS.createTask("resumer", nullptr, midCycleResumer_loop, 0, nullptr, true, TaskPriority::Highest);
+    (void)OS.createTask("mid", nullptr, midCycleMid_loop, 0, nullptr, true, TaskPriority::Normal);
+    midCycleTargetId = OS.createTask("target", nullptr, midCycleTarget_loop, 0, nullptr, true, TaskPriority::Lowest);
+    OS.begin();
+    OS.pauseTask(midCycleTargetId);
+
+    OS.run();
+
+    // Target was paused when the cycle started, then resumed and raised above "mid"
+    assert(midCycleTargetRuns == 1);
+    assert(midCycleMidRuns == 1);
+    assert(midCycleTargetRanBeforeMid);
+
+    printf("PASSED\n");
+}
+
+// For priority aging test: records dispatch order as 'h' (hog) / 'l' (low)
+static char agingOrder[8];
+static uint8_t agingOrderLen = 0;
+void agingHog_loop() { if (agingOrderLen < sizeof(agingOrder) - 1) agingOrder[agingOrderLen++] = 'h'; }
+void agingLow_loop() { if (agingOrderLen < sizeof(agingOrder) - 1) agingOrder[agingOrderLen++] = 'l'; }
+static void agingRun() {
+    memset(agingOrder, 0, sizeof(agingOrder));
+    agingOrderLen = 0;
+    OS.run();
+}
+
+void test_priority_aging() {
+    printf("Test: priority aging lifts overdue low tasks... ");
+    resetTestCounters();
+
+    assert(OS.getPriorityAging() == 0);
+    (void)OS.createTask("hog", nullptr, agingHog_loop, 0, nullptr, true, TaskPriority::High);
+    int8_t low = OS.createTask("low", nullptr, agingLow_loop, 100, nullptr, true, TaskPriority::Lowest);
+    OS.begin();
+
+    // Disabled: an overdue Lowest task still runs after the hog
+    setMockMillis(120);
+    agingRun();
+    assert(strcmp(agingOrder, "hl") == 0);
+
+    OS.setPriorityAging(5);
+    assert(OS.getPriorityAging() == 5);
+
+    // Exactly due: no boost yet
+    setMockMillis(220);
+    agingRun();
+    assert(strcmp(agingOrder, "hl") == 0);
+
+    // 20ms overdue = 4 steps: Lowest -> Highest, ahead of the High hog
+    setMockMillis(340);
+    agingRun();
+    assert(strcmp(agingOrder, "lh") == 0);
+    assert(OS.getTaskPriority(low) == TaskPriority::Lowest);  // Base level is kept
+
+    // 10ms overdue = 2 steps: Lowest -> Normal, still behind the hog
+    setMockMillis(450);
+    agingRun();
+    assert(strcmp(agingOrder, "hl") == 0);
+
+    // Boost is gone once the task has run
+    setMockMillis(551);
+    agingRun();
+    assert(strcmp(agingOrder, "hl") == 0);
+
+    // Setting survives reset()
+    OS.reset();
+    assert(OS.getPriorityAging() == 5);
+    OS.setPriorityAging(0);
+
+    printf("PASSED\n");
+}
+
 // Test: createTask overload with timeout and recover (requires ARDA_TASK_RECOVERY)
 #ifdef ARDA_TASK_RECOVERY
 static int timeoutRecoverCalled = 0;
@@ -5441,6 +6317,132 @@ void test_createTask_with_timeout_and_recover() {
 
 #endif // ARDA_NO_PRIORITY
 
+// For cycle budget test: each loop() takes 1ms and records its letter
+static char budgetOrder[8];
+static uint8_t budgetOrderLen = 0;
+static void budgetRecord(char c) {
+    if (budgetOrderLen < sizeof(budgetOrder) - 1) budgetOrder[budgetOrderLen++] = c;
+    advanceMockMillis(1);
+}
+void budgetA_loop() { budgetRecord('a'); }
+void budgetB_loop() { budgetRecord('b'); }
+void budgetC_loop() { budgetRecord('c'); }
+void budgetH_loop() { budgetRecord('h'); }
+static void budgetRun() {
+    memset(budgetOrder, 0, sizeof(budgetOrder));
+    budgetOrderLen = 0;
+    OS.run();
+}
+
+void test_cycle_budget_defers_remaining_tasks() {
+    printf("Test: cycle budget defers remaining ready tasks to next run... ");
+    resetTestCounters();
+
+    assert(OS.getCycleBudgetUs() == 0);
+    (void)OS.createTask("a", nullptr, budgetA_loop, 0, nullptr, true, TaskPriority::High);
+    (void)OS.createTask("b", nullptr, budgetB_loop, 0);
+    int8_t c = OS.createTask("c", nullptr, budgetC_loop, 0);
+    OS.begin();
+
+    budgetRun();
+    assert(strcmp(budgetOrder, "abc") == 0);  // Unlimited by default
+
+    OS.setCycleBudgetUs(1500);
+    assert(OS.getCycleBudgetUs() == 1500);
+    budgetRun();
+    assert(strcmp(budgetOrder, "ab") == 0);   // Budget spent after b
+    budgetRun();
+    assert(strcmp(budgetOrder, "ac") == 0);   // c was owed a run: first in its level
+    budgetRun();
+    assert(strcmp(budgetOrder, "ab") == 0);
+
+    // A carried-over task that is paused loses its claim
+    OS.pauseTask(c);
+    OS.resumeTask(c);
+    budgetRun();
+    assert(strcmp(budgetOrder, "ab") == 0);   // c back in plain ID order
+    budgetRun();
+    assert(strcmp(budgetOrder, "ac") == 0);
+
+    // At least one task runs even if it alone exceeds the budget, and a carry-over
+    // never jumps a priority level
+    OS.setCycleBudgetUs(1);
+    budgetRun();
+    assert(strcmp(budgetOrder, "a") == 0);
+    budgetRun();
+    assert(strcmp(budgetOrder, "a") == 0);
+
+    OS.reset();
+    assert(OS.getCycleBudgetUs() == 1);  // Setting survives reset()
+    OS.setCycleBudgetUs(0);
+
+    printf("PASSED\n");
+}
+
+void test_cycle_budget_carry_keeps_priority() {
+    printf("Test: task becoming ready outranks a lower budget carry-over... ");
+    resetTestCounters();
+
+    (void)OS.createTask("l1", nullptr, budgetA_loop, 0, nullptr, true, TaskPriority::Lowest);
+    (void)OS.createTask("l2", nullptr, budgetB_loop, 0, nullptr, true, TaskPriority::Lowest);
+    (void)OS.createTask("l3", nullptr, budgetC_loop, 0, nullptr, true, TaskPriority::Lowest);
+    (void)OS.createTask("high", nullptr, budgetH_loop, 10, nullptr, true, TaskPriority::High);
+    OS.setCycleBudgetUs(1500);
+    OS.begin();
+
+    budgetRun();
+    assert(strcmp(budgetOrder, "ab") == 0);  // l3 carried over
+
+    setMockMillis(10);                        // 'high' becomes due
+    budgetRun();
+    assert(strcmp(budgetOrder, "hc") == 0);  // high first, then l3 ahead of its level
+    budgetRun();
+    assert(strcmp(budgetOrder, "ab") == 0);  // l1, l2 were owed next
+
+    OS.setCycleBudgetUs(0);
+    printf("PASSED\n");
+}
+
+static int staticTableRuns = 0;
+static int staticTableSetups = 0;
+void staticTable_setup() { staticTableSetups++; }
+void staticTable_loop() { staticTableRuns++; }
+
+ARDA_STATIC_TASKS(testStaticTasks,
+    ARDA_TASK_DEF("tblA", nullptr, staticTable_loop, 0),
+    ARDA_TASK_DEF_FULL("tblB", staticTable_setup, staticTable_loop, 10, nullptr, TaskPriority::High),
+    ARDA_TASK_DEF("tblA", nullptr, staticTable_loop, 0));  // Duplicate name: rejected
+
+void test_create_tasks_from_static_table() {
+    printf("Test: createTasks registers a static task table... ");
+    resetTestCounters();
+    staticTableRuns = 0;
+    staticTableSetups = 0;
+
+    int8_t failed = 0;
+    assert(OS.createTasks(testStaticTasks, &failed) == 2);
+    assert(failed == 2);
+    assert(OS.getError() == ArdaError::DuplicateName);
+
+    int8_t a = OS.findTaskByName("tblA");
+    int8_t b = OS.findTaskByName("tblB");
+    assert(a >= 0 && b >= 0);
+    assert(OS.getTaskInterval(b) == 10);
+    assert(OS.getTaskPriority(a) == TaskPriority::Normal);
+    assert(OS.getTaskPriority(b) == TaskPriority::High);
+    assert(OS.getTaskState(a) == TaskState::Stopped);  // autoStart waits for begin()
+
+    OS.begin();
+    assert(staticTableSetups == 1);
+    OS.run();
+    assert(staticTableRuns == 1);  // tblB not due yet
+
+    assert(OS.createTasks(nullptr, 3) == 0);
+    assert(OS.getError() == ArdaError::Ok);
+
+    printf("PASSED\n");
+}
+
 int main() {
     printf("\n=== Arda Unit Tests ===\n\n");
 
@@ -5458,6 +6460,7 @@ int main() {
     test_find_task_by_name();
     test_rename_task();
     test_renameTask_on_deleted();
+    test_create_tasks_from_static_table();
 
     // ---- Task Lifecycle (Start/Stop/Pause/Resume) ----
     test_task_states();
@@ -5516,6 +6519,32 @@ int main() {
     test_uptime();
     test_millis_ovrflow_interval();
     test_millis_ovrflow_uptime();
+    test_deadline_queue_mixed_intervals();
+    test_deadline_queue_follows_interval_and_pause();
+    test_interval_above_max_rejected();
+    test_ms_until_next_due();
+    test_run_or_sleep_calls_idle_callback();
+    test_run_or_sleep_skips_idle_when_ready();
+    test_clock_source_virtual();
+    test_clock_read_once_per_dispatch();
+    test_set_clock_source();
+    test_micros_interval_task();
+    test_micros_interval_wraparound();
+    test_set_task_interval_switches_unit();
+    test_event_task_runs_only_when_notified();
+    test_event_task_stays_ready_until_taken();
+    test_event_task_interval_timeout();
+    test_notify_task_errors_and_non_event_tasks();
+    test_notify_wakes_event_task_same_cycle();
+    test_defer_wakes_event_task();
+    test_defer_handler_in_order_and_bounded();
+    test_queue_basic_fifo();
+    test_queue_pipeline_wakes_consumers();
+    test_queue_stale_consumer_keeps_error();
+    test_task_timing_fixed_rate_no_drift();
+    test_task_timing_catch_up();
+    test_cycle_budget_defers_remaining_tasks();
+    test_cycle_budget_carry_keeps_priority();
 
     // ---- Timeouts ----
     test_task_timeout();
@@ -5650,6 +6679,9 @@ int main() {
     test_priority_uses_fresh_millis_for_readiness();
     test_self_restart_no_double_execution();
     test_priority_autostart_before_begin();
+    test_priority_bitmap_order_many_tasks();
+    test_priority_bitmap_sees_mid_cycle_resume();
+    test_priority_aging();
 #ifdef ARDA_TASK_RECOVERY
     test_createTask_with_timeout_and_recover();
 #endif
@@ -0,0 +1,257 @@
+// Test for hierarchical schedulers (ARDA_CHILD_SCHEDULERS)
+// Build: g++ -std=c++11 -I. -o test_child_scheduler test_child_scheduler.cpp && ./test_child_scheduler
+//
+// This verifies that:
+// 1. A mounted child runs its own tasks only when the parent dispatches the mount task
+// 2. Starting the mount task begins the child, which shares the parent's clock
+// 3. The mount budget bounds the child's cycle; cut-off tasks run first next time
+// 4. A parent's own cycle budget also bounds the child's cycle
+// 5. Mounting a scheduler on itself or a child begun on another clock fails, and
+//    getChildScheduler() finds only mounts
+// 6. A child is mounted once at a time; deleting the mount or a reset frees it
+// 7. The shell 'l' command lists mounted children as an indented tree
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable child schedulers BEFORE including Arda (keeps the shell for the tree test)
+#define ARDA_CHILD_SCHEDULERS
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+static int rxRuns = 0;
+static int txRuns = 0;
+static int slowRuns = 0;
+void rxLoop() { rxRuns++; }
+void txLoop() { txRuns++; }
+void slowLoop() {  // Takes 1 ms of (mock) time per run
+    slowRuns++;
+    setMockMillis(millis() + 1);
+}
+
+static uint32_t virtualTime = 0;
+uint32_t virtualClock() { return virtualTime; }
+
+void resetTestCounters() {
+    rxRuns = 0;
+    txRuns = 0;
+    slowRuns = 0;
+    virtualTime = 0;
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+void test_child_runs_at_mount_interval() {
+    printf("Test: child runs only when its mount task is due... ");
+    resetTestCounters();
+
+    Arda comms;
+    comms.createTask("rx", nullptr, rxLoop, 0);
+    int8_t mount = OS.mountScheduler("comms", comms, 10);
+    assert(mount >= 0);
+    assert(OS.getChildScheduler(mount) == &comms);
+
+    assert(!comms.hasBegun());
+    OS.begin();
+    assert(comms.hasBegun());  // Mount task's setup() began the child
+
+    for (uint32_t t = 0; t <= 30; t++) {
+        setMockMillis(t);
+        OS.run();
+    }
+    // Interval-0 child task runs once per parent dispatch: t=10, 20, 30
+    assert(rxRuns == 3);
+    assert(OS.getTaskRunCount(mount) == 3);
+
+    // Pausing the mount task pauses the whole subsystem
+    OS.pauseTask(mount);
+    setMockMillis(40);
+    OS.run();
+    assert(rxRuns == 3);
+
+    printf("PASSED\n");
+}
+
+void test_child_shares_parent_clock() {
+    printf("Test: child inherits the parent's clock source... ");
+    resetTestCounters();
+
+    Arda parent;
+    Arda child;
+    parent.setClockSource(virtualClock);
+    child.createTask("tx", nullptr, txLoop, 100);
+    assert(parent.mountScheduler("child", child) >= 0);
+    parent.begin();
+
+    setMockMillis(1000);  // millis() moves, the virtual clock does not
+    parent.run();
+    assert(txRuns == 0);
+
+    virtualTime = 100;
+    parent.run();
+    assert(txRuns == 1);
+
+    printf("PASSED\n");
+}
+
+void test_mount_budget_limits_child() {
+    printf("Test: mount budget bounds each child cycle... ");
+    resetTestCounters();
+
+    Arda sensors;
+    for (int k = 0; k < 3; k++) {
+        char name[4] = {'s', (char)('0' + k), '\0', '\0'};
+        assert(sensors.createTask(name, nullptr, slowLoop, 0) >= 0);
+    }
+    int8_t mount = OS.mountScheduler("sensors", sensors, 0, 2000);  // 2 ms per cycle
+    assert(mount >= 0);
+    assert(sensors.getCycleBudgetUs() == 2000);
+    OS.begin();
+
+    OS.run();
+    assert(slowRuns == 2);  // Third task cut off by the budget
+    OS.run();
+    assert(slowRuns == 4);  // Carried task first, then one more
+
+    printf("PASSED\n");
+}
+
+void test_child_budget_clamped_to_parent() {
+    printf("Test: child cycle is cut to the parent's remaining budget... ");
+    resetTestCounters();
+
+    Arda sensors;
+    for (int k = 0; k < 3; k++) {
+        char name[4] = {'s', (char)('0' + k), '\0', '\0'};
+        sensors.createTask(name, nullptr, slowLoop, 0);
+    }
+    OS.createTask("pre", nullptr, slowLoop, 0);  // Uses 1 ms of the parent's 2 ms
+    int8_t mount = OS.mountScheduler("sensors", sensors);  // No budget of its own
+    OS.setCycleBudgetUs(2000);
+    OS.begin();
+
+    OS.run();
+    assert(slowRuns == 2);  // 'pre' plus one child task in the 1 ms left
+    assert(OS.getTaskRunCount(mount) == 1);
+    assert(sensors.getCycleBudgetUs() == 0);  // Mount budget restored after the cycle
+
+    // Without a parent budget the child runs its whole cycle
+    OS.setCycleBudgetUs(0);
+    slowRuns = 0;
+    OS.run();
+    assert(slowRuns == 1 + 3);
+
+    printf("PASSED\n");
+}
+
+void test_mount_errors() {
+    printf("Test: invalid mounts and lookups... ");
+    resetTestCounters();
+
+    assert(OS.mountScheduler("self", OS) == -1);
+    assert(OS.getError() == ArdaError::InvalidValue);
+
+    Arda child;
+    assert(OS.mountScheduler("", child) == -1);  // createTask() errors pass through
+    assert(OS.getError() == ArdaError::EmptyName);
+
+    // A child that began on another clock would mix time bases
+    Arda begun;
+    begun.setClockSource(virtualClock);
+    begun.begin();
+    assert(OS.mountScheduler("begun", begun) == -1);
+    assert(OS.getError() == ArdaError::AlreadyBegun);
+
+    int8_t plain = OS.createTask("plain", nullptr, rxLoop, 0);
+    assert(OS.getChildScheduler(plain) == nullptr);
+    assert(OS.getChildScheduler(-1) == nullptr);
+    assert(OS.getChildScheduler(ARDA_SHELL_TASK_ID) == nullptr);
+
+    printf("PASSED\n");
+}
+
+void test_mount_once() {
+    printf("Test: a child is mounted on one scheduler at a time... ");
+    resetTestCounters();
+
+    Arda p1;
+    Arda p2;
+    Arda child;
+    int8_t mount = p1.mountScheduler("m", child, 10, 2000);
+    assert(mount >= 0);
+
+    assert(p2.mountScheduler("m", child, 10, 0) == -1);
+    assert(p2.getError() == ArdaError::WrongState);
+    assert(p1.mountScheduler("m2", child) == -1);  // Not twice on the same one either
+    assert(p1.getError() == ArdaError::WrongState);
+    assert(child.getCycleBudgetUs() == 2000);       // The first mount's budget is kept
+
+    // Deleting the mount task frees the child
+    assert(p1.deleteTask(mount));
+    assert(p2.mountScheduler("m", child, 10, 500) >= 0);
+    assert(child.getCycleBudgetUs() == 500);
+
+    // So does resetting the scheduler it is mounted on
+    p2.reset();
+    assert(p1.mountScheduler("m", child) >= 0);
+
+    printf("PASSED\n");
+}
+
+void test_shell_lists_tree() {
+    printf("Test: shell 'l' shows mounted children as a tree... ");
+    resetTestCounters();
+
+    MockStream mockStream;
+    OS.setShellStream(mockStream);
+
+    Arda comms;
+    comms.createTask("rx", nullptr, rxLoop, 0);
+    comms.createTask("tx", nullptr, txLoop, 0, nullptr, false);
+    OS.mountScheduler("comms", comms, 10);
+    OS.createTask("led", nullptr, txLoop, 500);
+    OS.begin();
+
+    mockStream.setInput("l\n");
+    mockStream.clearOutput();
+    OS.run();
+
+    const char* output = mockStream.getOutput();
+    const char* parent = strstr(output, "1 R comms");
+    assert(parent != nullptr);
+    const char* rx = strstr(output, "  0 R rx");
+    const char* tx = strstr(output, "  1 S tx");
+    const char* led = strstr(output, "2 R led");
+    assert(rx != nullptr && tx != nullptr && led != nullptr);
+    assert(parent < rx && rx < tx && tx < led);  // Children right under their mount
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== Child Scheduler Tests ===\n\n");
+
+    test_child_runs_at_mount_interval();
+    test_child_shares_parent_clock();
+    test_mount_budget_limits_child();
+    test_child_budget_clamped_to_parent();
+    test_mount_errors();
+    test_mount_once();
+    test_shell_lists_tree();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
@@ -0,0 +1,250 @@
+// Test for ARDA_COROUTINES feature
+// Build: g++ -std=c++11 -I. -o test_coroutine test_coroutine.cpp && ./test_coroutine
+//
+// This verifies that:
+// 1. Coroutine tasks resume after yield() where they left off
+// 2. sleep() parks a coroutine in the deadline heap, then restores its interval;
+//    setTaskInterval() mid-sleep neither ends the sleep nor is lost on wake
+// 3. Many suspended coroutines don't consume scheduler stack or callback depth
+// 4. stopTask() rewinds a coroutine; deleteTask() frees its slot
+// 5. Invalid stacks, exhausted slots and sleep() outside a coroutine are rejected
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable coroutines and disable shell BEFORE including Arda
+#define ARDA_COROUTINES
+#define ARDA_NO_SHELL
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+void resetTestCounters() {
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+alignas(16) static uint8_t stackA[16384];
+alignas(16) static uint8_t stackB[16384];
+
+// Straight-line body: one step per dispatch
+static int linearStep = 0;
+void linear_body() {
+    linearStep = 1;
+    OS.yield();
+    linearStep = 2;
+    OS.yield();
+    linearStep = 3;
+}
+
+void test_coroutine_resumes_after_yield() {
+    printf("Test: coroutine resumes after yield()... ");
+    resetTestCounters();
+    linearStep = 0;
+
+    int8_t id = OS.createCoroutine("lin", linear_body, stackA, sizeof(stackA));
+    assert(id >= 0);
+    assert(OS.isTaskCoroutine(id));
+    OS.begin();
+
+    OS.run();
+    assert(linearStep == 1);
+    OS.run();
+    assert(linearStep == 2);
+    OS.run();
+    assert(linearStep == 3);   // Body returned
+    assert(OS.getTaskRunCount(id) == 3);
+    linearStep = 0;
+    OS.run();
+    assert(linearStep == 1);   // Started over from the top
+
+    printf("PASSED\n");
+}
+
+// Periodic body written as a plain loop with sleep()
+static int sleeperTicks = 0;
+static uint32_t sleeperIntervalAfterWake = 99;
+static int8_t sleeperId = -1;
+void sleeper_body() {
+    for (;;) {
+        sleeperTicks++;
+        assert(OS.sleep(50));
+        sleeperIntervalAfterWake = OS.getTaskInterval(sleeperId);
+    }
+}
+
+void test_coroutine_sleep() {
+    printf("Test: sleep() suspends without polling... ");
+    resetTestCounters();
+    sleeperTicks = 0;
+
+    sleeperId = OS.createCoroutine("slp", sleeper_body, stackA, sizeof(stackA));
+    OS.begin();
+
+    OS.run();
+    assert(sleeperTicks == 1);
+    assert(OS.getTaskInterval(sleeperId) == 0);    // Own interval, not the sleep span
+    assert(OS.msUntilNextDue() == 50);
+
+    setMockMillis(49);
+    OS.run();
+    assert(sleeperTicks == 1);
+    assert(OS.msUntilNextDue() == 1);
+
+    setMockMillis(50);
+    OS.run();
+    assert(sleeperTicks == 2);
+    assert(sleeperIntervalAfterWake == 0);          // Own interval restored on wake
+
+    // Not in a coroutine
+    assert(!OS.sleep(10));
+    assert(OS.getError() == ArdaError::WrongState);
+
+    printf("PASSED\n");
+}
+
+// Runs once per interval and sleeps for a long time on its second run
+static int napperRuns = 0;
+void napper_body() {
+    for (;;) {
+        napperRuns++;
+        if (napperRuns == 2) OS.sleep(1000);
+        OS.yield();
+    }
+}
+
+void test_set_interval_during_sleep() {
+    printf("Test: setTaskInterval() during sleep() keeps the sleep... ");
+    resetTestCounters();
+    napperRuns = 0;
+
+    int8_t id = OS.createCoroutine("nap", napper_body, stackA, sizeof(stackA), 10);
+    OS.begin();
+    setMockMillis(10);
+    OS.run();                                       // Run 1
+    setMockMillis(20);
+    OS.run();                                       // Run 2: sleep(1000) until t=1020
+    assert(napperRuns == 2);
+
+    assert(OS.setTaskInterval(id, 50));
+    assert(OS.getTaskInterval(id) == 50);
+    setMockMillis(70);
+    OS.run();
+    assert(napperRuns == 2);                        // The new interval did not end the sleep
+
+    setMockMillis(1020);
+    OS.run();                                       // Wakes, then yields
+    assert(OS.getTaskInterval(id) == 50);           // New interval survived the wake
+    setMockMillis(1069);
+    OS.run();
+    assert(napperRuns == 2);
+    setMockMillis(1070);
+    OS.run();
+    assert(napperRuns == 3);
+
+    printf("PASSED\n");
+}
+
+// Two coroutines ping-pong far more times than ARDA_MAX_CALLBACK_DEPTH
+static int pingCount = 0;
+static int pongCount = 0;
+void ping_body() { for (;;) { pingCount++; OS.yield(); } }
+void pong_body() { for (;;) { pongCount++; OS.yield(); } }
+
+void test_coroutine_no_depth_growth() {
+    printf("Test: suspended coroutines don't nest... ");
+    resetTestCounters();
+    pingCount = 0;
+    pongCount = 0;
+
+    OS.createCoroutine("ping", ping_body, stackA, sizeof(stackA));
+    OS.createCoroutine("pong", pong_body, stackB, sizeof(stackB));
+    OS.begin();
+
+    for (int i = 0; i < 1000; i++) OS.run();
+    assert(pingCount == 1000);
+    assert(pongCount == 1000);
+
+    printf("PASSED\n");
+}
+
+void test_coroutine_stop_and_delete() {
+    printf("Test: stopTask rewinds, deleteTask frees slot... ");
+    resetTestCounters();
+    linearStep = 0;
+
+    int8_t id = OS.createCoroutine("lin", linear_body, stackA, sizeof(stackA));
+    OS.begin();
+    OS.run();
+    OS.run();
+    assert(linearStep == 2);
+
+    OS.stopTask(id);
+    OS.startTask(id);
+    OS.run();
+    assert(linearStep == 1);   // Rewound, not resumed
+
+    // All slots taken
+    int8_t ids[ARDA_MAX_COROUTINES];
+    ids[0] = id;
+    char name[4] = "c0";
+    for (int k = 1; k < ARDA_MAX_COROUTINES; k++) {
+        name[1] = (char)('0' + k);
+        ids[k] = OS.createCoroutine(name, linear_body, stackB, sizeof(stackB), 0, nullptr, false);
+        assert(ids[k] >= 0);
+    }
+    assert(OS.createCoroutine("full", linear_body, stackB, sizeof(stackB)) == -1);
+    assert(OS.getError() == ArdaError::MaxTasks);
+
+    // Deleting a suspended coroutine frees its slot
+    OS.stopTask(id);
+    assert(OS.deleteTask(id));
+    assert(OS.createCoroutine("again", linear_body, stackA, sizeof(stackA)) >= 0);
+
+    printf("PASSED\n");
+}
+
+void test_coroutine_invalid_args() {
+    printf("Test: createCoroutine validates stack... ");
+    resetTestCounters();
+
+    assert(OS.createCoroutine("a", linear_body, nullptr, 4096) == -1);
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(OS.createCoroutine("a", linear_body, stackA, ARDA_MIN_CORO_STACK - 1) == -1);
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(OS.createCoroutine("a", nullptr, stackA, sizeof(stackA)) == -1);
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(OS.getTaskCount() == 0);
+
+    int8_t plain = OS.createTask("plain", nullptr, linear_body, 0);
+    assert(!OS.isTaskCoroutine(plain));
+    assert(!OS.isTaskCoroutine(99));
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== ARDA_COROUTINES Tests ===\n\n");
+
+    test_coroutine_resumes_after_yield();
+    test_coroutine_sleep();
+    test_set_interval_during_sleep();
+    test_coroutine_no_depth_growth();
+    test_coroutine_stop_and_delete();
+    test_coroutine_invalid_args();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
@@ -0,0 +1,179 @@
+// Test for run-after dependencies (ARDA_MAX_DEPENDENCIES)
+// Build: g++ -std=c++11 -I. -o test_dependencies test_dependencies.cpp && ./test_dependencies
+//
+// This verifies that:
+// 1. A pipeline runs in dependency order regardless of priority and task IDs
+// 2. A 'before' task that is not due this cycle does not hold its successor back
+// 3. onlyIfRan edges trigger event tasks and gate polling tasks on their input
+// 4. Cycles, self edges and a full pool are rejected; deleting a task drops its edges
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable dependencies and disable shell BEFORE including Arda
+#define ARDA_MAX_DEPENDENCIES 4
+#define ARDA_NO_SHELL
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+// Execution order log: one letter per loop() call
+static char order[32];
+static int orderLen = 0;
+static void logRun(char c) {
+    if (orderLen < (int)sizeof(order) - 1) {
+        order[orderLen++] = c;
+        order[orderLen] = '\0';
+    }
+}
+void sensorLoop() { logRun('s'); }
+void filterLoop() { logRun('f'); }
+void controlLoop() { logRun('c'); }
+void actuateLoop() { logRun('a'); }
+void nopLoop() {}
+
+void resetTestCounters() {
+    order[0] = '\0';
+    orderLen = 0;
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+void test_pipeline_order() {
+    printf("Test: pipeline runs in dependency order... ");
+    resetTestCounters();
+
+    // Created back to front, actuator at the highest priority
+    int8_t act = OS.createTask("act", nullptr, actuateLoop, 0);
+    int8_t ctl = OS.createTask("ctl", nullptr, controlLoop, 0);
+    int8_t flt = OS.createTask("flt", nullptr, filterLoop, 0);
+    int8_t sen = OS.createTask("sen", nullptr, sensorLoop, 0);
+#ifndef ARDA_NO_PRIORITY
+    OS.setTaskPriority(act, TaskPriority::Highest);
+    OS.setTaskPriority(sen, TaskPriority::Lowest);
+#endif
+    assert(OS.addDependency(sen, flt));
+    assert(OS.addDependency(flt, ctl));
+    assert(OS.addDependency(ctl, act));
+    assert(OS.hasDependency(flt, ctl));
+    assert(!OS.hasDependency(ctl, flt));
+    OS.begin();
+
+    OS.run();
+    assert(strcmp(order, "sfca") == 0);
+    OS.run();
+    assert(strcmp(order, "sfcasfca") == 0);
+
+    printf("PASSED\n");
+}
+
+void test_not_due_before_does_not_block() {
+    printf("Test: successor runs alone when its input is not due... ");
+    resetTestCounters();
+
+    int8_t flt = OS.createTask("flt", nullptr, filterLoop, 0);
+    int8_t sen = OS.createTask("sen", nullptr, sensorLoop, 10);
+    OS.addDependency(sen, flt);
+    OS.begin();
+
+    OS.run();  // Sensor's first run is at t=10
+    assert(strcmp(order, "f") == 0);
+    setMockMillis(10);
+    OS.run();
+    assert(strcmp(order, "fsf") == 0);  // Filter waited for the sensor
+
+    printf("PASSED\n");
+}
+
+void test_only_if_ran() {
+    printf("Test: onlyIfRan triggers and gates successors... ");
+    resetTestCounters();
+
+    int8_t ctl = OS.createTask("ctl", nullptr, controlLoop, 0);  // Polling, gated
+    int8_t flt = OS.createEventTask("flt", nullptr, filterLoop);  // Event task, triggered
+    int8_t sen = OS.createTask("sen", nullptr, sensorLoop, 10);
+    assert(OS.addDependency(sen, flt, true));
+    assert(OS.addDependency(flt, ctl, true));
+    OS.begin();
+
+    OS.run();
+    assert(orderLen == 0);  // No sensor run, so nothing downstream runs
+    OS.run();
+    assert(orderLen == 0);
+
+    setMockMillis(10);
+    OS.run();
+    assert(strcmp(order, "sfc") == 0);
+    OS.run();
+    assert(strcmp(order, "sfc") == 0);  // Triggered once per input run
+
+    // Without the gate, the polling task runs every cycle again
+    assert(OS.removeDependency(flt, ctl));
+    assert(!OS.removeDependency(flt, ctl));
+    assert(OS.getError() == ArdaError::InvalidId);
+    OS.run();
+    assert(strcmp(order, "sfcc") == 0);
+
+    printf("PASSED\n");
+}
+
+void test_dependency_errors() {
+    printf("Test: cycles, self edges, pool limit and deletion... ");
+    resetTestCounters();
+
+    int8_t a = OS.createTask("a", nullptr, nopLoop, 0);
+    int8_t b = OS.createTask("b", nullptr, nopLoop, 0);
+    int8_t c = OS.createTask("c", nullptr, nopLoop, 0);
+    int8_t d = OS.createTask("d", nullptr, nopLoop, 0);
+    int8_t e = OS.createTask("e", nullptr, nopLoop, 0);
+
+    assert(!OS.addDependency(a, a));
+    assert(OS.getError() == ArdaError::InvalidId);
+    assert(!OS.addDependency(a, -1));
+    assert(OS.getError() == ArdaError::InvalidId);
+
+    assert(OS.addDependency(a, b));
+    assert(OS.addDependency(b, c));
+    assert(!OS.addDependency(c, a));  // a -> b -> c -> a
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(OS.addDependency(a, b, true));  // Existing edge: mode update, no new slot
+
+    assert(OS.addDependency(c, d));
+    assert(OS.addDependency(d, e));
+    assert(!OS.addDependency(a, e));  // Pool of 4 is full
+    assert(OS.getError() == ArdaError::NoDependencies);
+
+    // Deleting b drops a->b and b->c; its slot comes back unordered
+    assert(OS.deleteTask(b));
+    assert(!OS.hasDependency(a, b));
+    int8_t reused = OS.createTask("r", nullptr, nopLoop, 0);
+    assert(reused == b);
+    assert(!OS.hasDependency(reused, c));
+    assert(OS.addDependency(a, e));  // Freed slots are reusable
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== Dependency Tests ===\n\n");
+
+    test_pipeline_order();
+    test_not_due_before_does_not_block();
+    test_only_if_ran();
+    test_dependency_errors();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
@@ -0,0 +1,169 @@
+// Test for ARDA_EDF feature
+// Build: g++ -std=c++11 -I. -o test_edf test_edf.cpp && ./test_edf
+//
+// This verifies that:
+// 1. SchedulerPolicy / deadline APIs are available when ARDA_EDF is defined
+// 2. The default Priority policy keeps its priority-then-ID order
+// 3. Edf dispatches the ready task with the nearest deadline first
+// 4. Explicit relative deadlines override the interval
+// 5. Millisecond and microsecond tasks are compared on one time line
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable EDF and disable shell BEFORE including Arda
+#define ARDA_EDF
+#define ARDA_NO_SHELL
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+// Dispatch order of the last run(), as 'a'/'b'
+static char order[8];
+static uint8_t orderLen = 0;
+
+void resetTestCounters() {
+    memset(order, 0, sizeof(order));
+    orderLen = 0;
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+void taskA_loop() { if (orderLen < sizeof(order) - 1) order[orderLen++] = 'a'; }
+void taskB_loop() { if (orderLen < sizeof(order) - 1) order[orderLen++] = 'b'; }
+
+void test_edf_api_available() {
+    printf("Test: EDF API available... ");
+    resetTestCounters();
+
+    assert(OS.getSchedulerPolicy() == SchedulerPolicy::Priority);
+    assert(OS.setSchedulerPolicy(SchedulerPolicy::Edf));
+    assert(OS.getSchedulerPolicy() == SchedulerPolicy::Edf);
+    assert(!OS.setSchedulerPolicy(static_cast<SchedulerPolicy>(7)));
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(OS.getSchedulerPolicy() == SchedulerPolicy::Edf);
+
+    int8_t a = OS.createTask("a", nullptr, taskA_loop, 100);
+    assert(OS.getTaskDeadline(a) == 0);
+    assert(OS.setTaskDeadline(a, 25));
+    assert(OS.getTaskDeadline(a) == 25);
+    assert(!OS.setTaskDeadline(a, ARDA_MAX_INTERVAL + 1));
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(!OS.setTaskDeadline(99, 10));
+    assert(OS.getError() == ArdaError::InvalidId);
+    assert(OS.getTaskDeadline(99) == 0);
+
+    // Policy survives reset(), deadlines do not
+    OS.reset();
+    assert(OS.getSchedulerPolicy() == SchedulerPolicy::Edf);
+    a = OS.createTask("a", nullptr, taskA_loop, 100);
+    assert(OS.getTaskDeadline(a) == 0);
+
+    printf("PASSED\n");
+}
+
+void test_priority_policy_unchanged() {
+    printf("Test: Priority policy keeps ID order... ");
+    resetTestCounters();
+
+    OS.createTask("a", nullptr, taskA_loop, 100);
+    OS.createTask("b", nullptr, taskB_loop, 50);
+    OS.begin();
+
+    setMockMillis(100);  // Both due; b has been due for 50ms longer
+    OS.run();
+    assert(strcmp(order, "ab") == 0);
+
+    printf("PASSED\n");
+}
+
+void test_edf_nearest_deadline_first() {
+    printf("Test: EDF runs nearest deadline first... ");
+    resetTestCounters();
+
+    OS.setSchedulerPolicy(SchedulerPolicy::Edf);
+    OS.createTask("a", nullptr, taskA_loop, 100);  // Deadline 100
+    OS.createTask("b", nullptr, taskB_loop, 50);   // Deadline 50
+    OS.begin();
+
+    setMockMillis(100);
+    OS.run();
+    assert(strcmp(order, "ba") == 0);
+
+    printf("PASSED\n");
+}
+
+void test_edf_explicit_deadline() {
+    printf("Test: EDF honours explicit relative deadline... ");
+    resetTestCounters();
+
+    OS.setSchedulerPolicy(SchedulerPolicy::Edf);
+    int8_t a = OS.createTask("a", nullptr, taskA_loop, 100);
+    OS.createTask("b", nullptr, taskB_loop, 50);
+    OS.setTaskDeadline(a, 10);  // Deadline 10 beats b's 50
+    OS.begin();
+
+    setMockMillis(100);
+    OS.run();
+    assert(strcmp(order, "ab") == 0);
+
+    printf("PASSED\n");
+}
+
+void test_edf_deadline_ties_use_priority() {
+    printf("Test: EDF breaks ties by priority... ");
+    resetTestCounters();
+
+    OS.setSchedulerPolicy(SchedulerPolicy::Edf);
+    OS.createTask("a", nullptr, taskA_loop, 100);
+    OS.createTask("b", nullptr, taskB_loop, 100, nullptr, true, TaskPriority::High);
+    OS.begin();
+
+    setMockMillis(100);
+    OS.run();
+    assert(strcmp(order, "ba") == 0);
+
+    printf("PASSED\n");
+}
+
+void test_edf_mixed_units() {
+    printf("Test: EDF compares ms and us deadlines... ");
+    resetTestCounters();
+
+    OS.setSchedulerPolicy(SchedulerPolicy::Edf);
+    OS.createTask("a", nullptr, taskA_loop, 150);             // Deadline 150ms
+    OS.createTaskMicros("b", nullptr, taskB_loop, 100000);    // Deadline 100ms
+    OS.begin();
+
+    setMockMillis(150);
+    OS.run();
+    assert(strcmp(order, "ba") == 0);
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== ARDA_EDF Tests ===\n\n");
+
+    test_edf_api_available();
+    test_priority_policy_unchanged();
+    test_edf_nearest_deadline_first();
+    test_edf_explicit_deadline();
+    test_edf_deadline_ties_use_priority();
+    test_edf_mixed_units();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Test for borrowed task names (ARDA_FLASH_NAMES)
+// Build: g++ -std=c++11 -I. -o test_flash_names test_flash_names.cpp && ./test_flash_names
+//
+// This verifies that:
+// 1. Task names are stored as pointers, not copied
+// 2. Name validation, duplicates and findTaskByName() work as with copied names
+// 3. Deletion uses the state bits, so slots and names are reusable
+// 4. renameTask() and static task tables borrow their names too
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable borrowed names and disable shell BEFORE including Arda
+#define ARDA_FLASH_NAMES
+#define ARDA_NO_SHELL
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+static int runs = 0;
+void countLoop() { runs++; }
+
+void resetTestCounters() {
+    runs = 0;
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+static const char blinkName[] ARDA_PROGMEM = "blink";
+static const char sensorName[] ARDA_PROGMEM = "sensor";
+static const char renamed[] ARDA_PROGMEM = "renamed";
+
+void test_names_are_borrowed() {
+    printf("Test: names are stored as pointers... ");
+    resetTestCounters();
+
+    static_assert(sizeof(((Task*)nullptr)->name) == sizeof(const char*), "name is a pointer");
+    int8_t a = OS.createTask(blinkName, nullptr, countLoop, 0);
+    int8_t b = OS.createTask(sensorName, nullptr, countLoop, 10);
+    assert(a >= 0 && b >= 0);
+    assert(OS.getTaskName(a) == blinkName);  // Same pointer, no copy
+    assert(OS.findTaskByName("sensor") == b);
+
+    // Same validation as copied names
+    assert(OS.createTask("blink", nullptr, countLoop, 0) == -1);
+    assert(OS.getError() == ArdaError::DuplicateName);
+    assert(OS.createTask("", nullptr, countLoop, 0) == -1);
+    assert(OS.getError() == ArdaError::EmptyName);
+    assert(OS.createTask("abcdefghijklmnop", nullptr, countLoop, 0) == -1);
+    assert(OS.getError() == ArdaError::NameTooLong);
+    assert(OS.createTask(nullptr, nullptr, countLoop, 0) == -1);
+    assert(OS.getError() == ArdaError::NullName);
+
+    assert(OS.renameTask(a, renamed));
+    assert(OS.getTaskName(a) == renamed);
+    assert(OS.findTaskByName("blink") == -1);
+    assert(!OS.renameTask(b, "renamed"));
+    assert(OS.getError() == ArdaError::DuplicateName);
+
+    OS.begin();
+    OS.run();
+    assert(runs == 1);
+
+    printf("PASSED\n");
+}
+
+void test_delete_uses_state_bits() {
+    printf("Test: deleted slots are marked in the state bits... ");
+    resetTestCounters();
+
+    int8_t a = OS.createTask(blinkName, nullptr, countLoop, 0);
+    assert(OS.deleteTask(a));
+    assert(!OS.isValidTask(a));
+    assert(OS.getTaskName(a) == nullptr);
+    assert(OS.findTaskByName("blink") == -1);
+    assert(OS.getTaskCount() == 0);
+
+    // The name and the slot are free again
+    int8_t again = OS.createTask(blinkName, nullptr, countLoop, 0);
+    assert(again == a);
+    assert(OS.getTaskState(again) == TaskState::Stopped);
+
+    OS.reset();
+    assert(OS.getTaskCount() == 0);
+    assert(OS.findTaskByName("blink") == -1);
+
+    printf("PASSED\n");
+}
+
+ARDA_STATIC_TASKS(tableTasks,
+    ARDA_TASK_DEF("first", nullptr, countLoop, 0),
+    ARDA_TASK_DEF("second", nullptr, countLoop, 0));
+
+void test_static_table_names() {
+    printf("Test: static task tables lend their names... ");
+    resetTestCounters();
+
+    assert(OS.createTasks(tableTasks) == 2);
+    int8_t id = OS.findTaskByName("second");
+    assert(id >= 0);
+    assert(OS.getTaskName(id) == tableTasks[1].name);
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== Flash Names Tests ===\n\n");
+
+    test_names_are_borrowed();
+    test_delete_uses_state_bits();
+    test_static_table_names();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
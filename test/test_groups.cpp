@@ -0,0 +1,207 @@
+// Test for task groups (ARDA_MAX_GROUPS)
+// Build: g++ -std=c++11 -I. -o test_groups test_groups.cpp && ./test_groups
+//
+// This verifies that:
+// 1. pauseGroup()/resumeGroup() hold members back without touching their state
+//    or firing per-task trace events
+// 2. A task in several groups runs only while none of them is paused
+// 3. stopGroup() stops every started member through stopTask() (teardown runs)
+// 4. Invalid groups/tasks are rejected and deleting a task leaves its groups
+// 5. msUntilNextDue() ignores held tasks
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable task groups and disable shell BEFORE including Arda
+#define ARDA_MAX_GROUPS 3
+#define ARDA_NO_SHELL
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+enum { GROUP_RADIO, GROUP_SENSORS, GROUP_DEBUG };
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+static int radioRuns = 0;
+static int sensorRuns = 0;
+static int ledRuns = 0;
+static int teardowns = 0;
+static int traceEvents = 0;
+void radioLoop() { radioRuns++; }
+void sensorLoop() { sensorRuns++; }
+void ledLoop() { ledRuns++; }
+void countTeardown() { teardowns++; }
+void countTrace(int8_t, TraceEvent event) {
+    if (event != TraceEvent::TaskLoopBegin && event != TraceEvent::TaskLoopEnd) traceEvents++;
+}
+
+void resetTestCounters() {
+    radioRuns = 0;
+    sensorRuns = 0;
+    ledRuns = 0;
+    teardowns = 0;
+    traceEvents = 0;
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+void test_pause_resume_group() {
+    printf("Test: pauseGroup/resumeGroup hold members back... ");
+    resetTestCounters();
+
+    int8_t rx = OS.createTask("rx", nullptr, radioLoop, 0);
+    int8_t tx = OS.createTask("tx", nullptr, radioLoop, 0);
+    int8_t led = OS.createTask("led", nullptr, ledLoop, 0);
+    assert(OS.addToGroup(rx, GROUP_RADIO));
+    assert(OS.addToGroup(tx, GROUP_RADIO));
+    assert(OS.isInGroup(rx, GROUP_RADIO));
+    assert(!OS.isInGroup(led, GROUP_RADIO));
+    OS.begin();
+    OS.setTraceCallback(countTrace);
+
+    OS.run();
+    assert(radioRuns == 2 && ledRuns == 1);
+
+    assert(OS.pauseGroup(GROUP_RADIO));
+    assert(OS.isGroupPaused(GROUP_RADIO));
+    assert(OS.isTaskHeld(rx) && OS.isTaskHeld(tx) && !OS.isTaskHeld(led));
+    OS.run();
+    OS.run();
+    assert(radioRuns == 2 && ledRuns == 3);
+    // Members keep their own state, and nothing was traced per task
+    assert(OS.getTaskState(rx) == TaskState::Running);
+    assert(traceEvents == 0);
+
+    assert(OS.resumeGroup(GROUP_RADIO));
+    assert(!OS.isTaskHeld(rx));
+    OS.run();
+    assert(radioRuns == 4 && ledRuns == 4);
+
+    printf("PASSED\n");
+}
+
+void test_multiple_groups() {
+    printf("Test: task in two groups runs only when both are resumed... ");
+    resetTestCounters();
+
+    int8_t imu = OS.createTask("imu", nullptr, sensorLoop, 0);
+    OS.addToGroup(imu, GROUP_SENSORS);
+    OS.addToGroup(imu, GROUP_DEBUG);
+    OS.begin();
+
+    OS.pauseGroup(GROUP_SENSORS);
+    OS.pauseGroup(GROUP_DEBUG);
+    OS.resumeGroup(GROUP_SENSORS);
+    OS.run();
+    assert(sensorRuns == 0);  // Still held by GROUP_DEBUG
+
+    // Leaving the paused group releases it
+    assert(OS.removeFromGroup(imu, GROUP_DEBUG));
+    OS.run();
+    assert(sensorRuns == 1);
+
+    printf("PASSED\n");
+}
+
+void test_stop_group() {
+    printf("Test: stopGroup stops started members with teardown... ");
+    resetTestCounters();
+
+    int8_t a = OS.createTask("a", nullptr, sensorLoop, 0, countTeardown);
+    int8_t b = OS.createTask("b", nullptr, sensorLoop, 0, countTeardown);
+    int8_t c = OS.createTask("c", nullptr, sensorLoop, 0, countTeardown, false);
+    int8_t d = OS.createTask("d", nullptr, ledLoop, 0, countTeardown);
+    OS.addToGroup(a, GROUP_SENSORS);
+    OS.addToGroup(b, GROUP_SENSORS);
+    OS.addToGroup(c, GROUP_SENSORS);  // Never started - skipped
+    OS.begin();
+    OS.pauseTask(b);
+
+    int8_t failed = 0;
+    assert(OS.stopGroup(GROUP_SENSORS, &failed) == 2);
+    assert(failed == -1);
+    assert(OS.getError() == ArdaError::Ok);
+    assert(teardowns == 2);
+    assert(OS.getTaskState(a) == TaskState::Stopped);
+    assert(OS.getTaskState(b) == TaskState::Stopped);
+    assert(OS.getTaskState(d) == TaskState::Running);
+
+    printf("PASSED\n");
+}
+
+void test_group_errors_and_delete() {
+    printf("Test: invalid groups and deleted members... ");
+    resetTestCounters();
+
+    int8_t id = OS.createTask("rx", nullptr, radioLoop, 0);
+    assert(!OS.addToGroup(id, ARDA_MAX_GROUPS));
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(!OS.pauseGroup(ARDA_MAX_GROUPS));
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(OS.stopGroup(ARDA_MAX_GROUPS) == 0);
+    assert(!OS.addToGroup(-1, GROUP_RADIO));
+    assert(OS.getError() == ArdaError::InvalidId);
+    assert(!OS.isGroupPaused(ARDA_MAX_GROUPS));
+
+    // A deleted task leaves its groups, so the reused slot starts ungrouped
+    OS.addToGroup(id, GROUP_RADIO);
+    OS.pauseGroup(GROUP_RADIO);
+    assert(OS.deleteTask(id));
+    int8_t reused = OS.createTask("led", nullptr, ledLoop, 0);
+    assert(reused == id);
+    assert(!OS.isInGroup(reused, GROUP_RADIO));
+    assert(!OS.isTaskHeld(reused));
+    OS.begin();
+    OS.run();
+    assert(ledRuns == 1);
+
+    printf("PASSED\n");
+}
+
+void test_next_due_ignores_held() {
+    printf("Test: msUntilNextDue() skips held tasks... ");
+    resetTestCounters();
+
+    int8_t fast = OS.createTask("fast", nullptr, radioLoop, 10);
+    int8_t every = OS.createTask("every", nullptr, radioLoop, 0);
+    OS.createTask("slow", nullptr, ledLoop, 100);
+    OS.addToGroup(fast, GROUP_RADIO);
+    OS.addToGroup(every, GROUP_RADIO);
+    OS.begin();
+    assert(OS.msUntilNextDue() == 0);  // 'every' is ready each cycle
+
+    OS.pauseGroup(GROUP_RADIO);
+    assert(OS.msUntilNextDue() == 100);
+
+    setMockMillis(50);  // 'fast' is overdue, but held
+    assert(OS.msUntilNextDue() == 50);
+
+    OS.resumeGroup(GROUP_RADIO);
+    assert(OS.msUntilNextDue() == 0);
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== Task Group Tests ===\n\n");
+
+    test_pause_resume_group();
+    test_multiple_groups();
+    test_stop_group();
+    test_group_errors_and_delete();
+    test_next_due_ignores_held();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
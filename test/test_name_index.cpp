@@ -0,0 +1,186 @@
+// Test for the hashed name index (ARDA_NAME_INDEX)
+// Build: g++ -std=c++11 -I. -o test_name_index test_name_index.cpp && ./test_name_index
+//
+// This verifies that:
+// 1. findTaskByName() finds every task through the index, including after collisions
+// 2. Create, rename, delete and reset keep the index in sync
+// 3. Duplicate checks use the index and agree with ARDA_CASE_INSENSITIVE_NAMES
+// 4. Heavy create/delete churn doesn't lose entries
+// 5. Deletion leaves no tombstones, so probe chains stay bounded under churn
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable a large task table with a small index (forces collisions) BEFORE including Arda
+#define ARDA_MAX_TASKS 100
+#define ARDA_NAME_INDEX
+#define ARDA_NAME_INDEX_SIZE 128
+#define ARDA_CASE_INSENSITIVE_NAMES
+#define ARDA_NO_SHELL
+#define ARDA_INTERNAL_TEST  // getNameIndex_() for the probe-length check
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+void emptyLoop() {}
+
+void resetTestCounters() {
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+static char names[ARDA_MAX_TASKS][ARDA_MAX_NAME_LEN];
+
+static void makeName(int k, char* out) {
+    snprintf(out, ARDA_MAX_NAME_LEN, "task%d", k);
+}
+
+void test_index_finds_all_tasks() {
+    printf("Test: index finds every task of a full table... ");
+    resetTestCounters();
+
+    for (int k = 0; k < ARDA_MAX_TASKS; k++) {
+        makeName(k, names[k]);
+        assert(OS.createTask(names[k], nullptr, emptyLoop, 0) == k);
+    }
+    for (int k = 0; k < ARDA_MAX_TASKS; k++) {
+        assert(OS.findTaskByName(names[k]) == k);
+    }
+    assert(OS.findTaskByName("TASK42") == 42);  // Case folded in the hash too
+    assert(OS.findTaskByName("task100") == -1);
+    assert(OS.findTaskByName("") == -1);
+
+    assert(OS.createTask("Task7", nullptr, emptyLoop, 0) == -1);
+    assert(OS.getError() == ArdaError::DuplicateName);  // Checked before the slot limit
+    assert(OS.deleteTask(0));
+    assert(OS.createTask("Task7", nullptr, emptyLoop, 0) == -1);
+    assert(OS.getError() == ArdaError::DuplicateName);
+
+    printf("PASSED\n");
+}
+
+void test_index_rename_delete_reset() {
+    printf("Test: rename, delete and reset update the index... ");
+    resetTestCounters();
+
+    int8_t a = OS.createTask("alpha", nullptr, emptyLoop, 0);
+    int8_t b = OS.createTask("beta", nullptr, emptyLoop, 0);
+    assert(OS.renameTask(a, "gamma"));
+    assert(OS.findTaskByName("alpha") == -1);
+    assert(OS.findTaskByName("gamma") == a);
+    assert(OS.renameTask(a, "GAMMA"));      // Same name, new spelling
+    assert(OS.findTaskByName("gamma") == a);
+    assert(!OS.renameTask(b, "Gamma"));
+    assert(OS.getError() == ArdaError::DuplicateName);
+
+    assert(OS.deleteTask(b));
+    assert(OS.findTaskByName("beta") == -1);
+    assert(OS.createTask("beta", nullptr, emptyLoop, 0) == b);
+    assert(OS.findTaskByName("beta") == b);
+
+    OS.reset();
+    assert(OS.findTaskByName("gamma") == -1);
+    assert(OS.createTask("gamma", nullptr, emptyLoop, 0) >= 0);
+
+    printf("PASSED\n");
+}
+
+void test_index_survives_churn() {
+    printf("Test: create/delete churn keeps the index consistent... ");
+    resetTestCounters();
+
+    for (int k = 0; k < ARDA_MAX_TASKS; k++) {
+        makeName(k, names[k]);
+        assert(OS.createTask(names[k], nullptr, emptyLoop, 0) == k);
+    }
+    // Repeatedly delete every other task and recreate it under a new name
+    char fresh[ARDA_MAX_NAME_LEN];
+    for (int round = 0; round < 5; round++) {
+        for (int k = round % 2; k < ARDA_MAX_TASKS; k += 2) {
+            assert(OS.deleteTask(OS.findTaskByName(names[k])));
+            snprintf(fresh, sizeof(fresh), "r%dt%d", round, k);
+            int8_t id = OS.createTask(fresh, nullptr, emptyLoop, 0);
+            assert(id >= 0);
+            strncpy(names[k], fresh, ARDA_MAX_NAME_LEN);
+        }
+        for (int k = 0; k < ARDA_MAX_TASKS; k++) {
+            int8_t id = OS.findTaskByName(names[k]);
+            assert(id >= 0);
+            assert(strcmp(OS.getTaskName(id), names[k]) == 0);
+        }
+    }
+    assert(OS.getTaskCount() == ARDA_MAX_TASKS);
+
+    printf("PASSED\n");
+}
+
+// Longest probe a lookup can take: from any home slot to the first empty slot
+static int longestProbe() {
+    const int8_t* index = OS.getNameIndex_();
+    int longest = 0;
+    for (int home = 0; home < ARDA_NAME_INDEX_SIZE; home++) {
+        int n = 1;
+        while (n <= ARDA_NAME_INDEX_SIZE && index[(home + n - 1) % ARDA_NAME_INDEX_SIZE] != -1) n++;
+        if (n > longest) longest = n;
+    }
+    return longest;
+}
+
+void test_index_probe_bounded_under_churn() {
+    printf("Test: deletes leave no tombstones, probes stay bounded... ");
+    resetTestCounters();
+
+    // Half-full table, then many rounds replacing every task with a new name
+    const int live = ARDA_MAX_TASKS / 2;
+    for (int k = 0; k < live; k++) {
+        makeName(k, names[k]);
+        assert(OS.createTask(names[k], nullptr, emptyLoop, 0) == k);
+    }
+    char fresh[ARDA_MAX_NAME_LEN];
+    for (int round = 0; round < 40; round++) {
+        for (int k = 0; k < live; k++) {
+            assert(OS.deleteTask(OS.findTaskByName(names[k])));
+            snprintf(fresh, sizeof(fresh), "c%dx%d", round, k);
+            assert(OS.createTask(fresh, nullptr, emptyLoop, 0) >= 0);
+            strncpy(names[k], fresh, ARDA_MAX_NAME_LEN);
+        }
+        // Only live entries occupy slots...
+        int used = 0;
+        for (int n = 0; n < ARDA_NAME_INDEX_SIZE; n++) {
+            if (OS.getNameIndex_()[n] != -1) used++;
+        }
+        assert(used == live);
+        // ...so a miss ends at an empty slot well before a full lap
+        assert(longestProbe() <= live + 1);
+        assert(OS.findTaskByName("missing") == -1);
+    }
+    for (int k = 0; k < live; k++) {
+        assert(OS.findTaskByName(names[k]) >= 0);
+    }
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== Name Index Tests ===\n\n");
+
+    test_index_finds_all_tasks();
+    test_index_rename_delete_reset();
+    test_index_survives_churn();
+    test_index_probe_bounded_under_churn();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
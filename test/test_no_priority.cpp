@@ -158,7 +158,7 @@ void test_flags_only_use_lower_bits() {
 
     // Without priority, flags should only use bits 0-3:
     // bits 0-1: state (Stopped=0, Running=1, Paused=2)
-    // bit 2: ranThisCycle
+    // bit 2: autoStart (before begin())
     // bit 3: inYield
     // bits 4-7: unused (should be 0)
 
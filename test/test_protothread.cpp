@@ -0,0 +1,199 @@
+// Test for ARDA_PROTOTHREADS feature
+// Build: g++ -std=c++11 -I. -o test_protothread test_protothread.cpp && ./test_protothread
+//
+// This verifies that:
+// 1. ARDA_TASK_BEGIN/ARDA_TASK_END resume a loop where it last waited
+// 2. ARDA_SLEEP keeps the task out of dispatch, then restores its interval
+// 3. ARDA_AWAIT polls its condition at the task's interval
+// 4. ARDA_AWAIT_NOTIFY waits in event mode until notifyTask()
+// 5. stopTask() rewinds the protothread to the top
+// 6. setTaskInterval() during ARDA_SLEEP changes the task's own interval, not the sleep
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable protothreads and disable shell BEFORE including Arda
+#define ARDA_PROTOTHREADS
+#define ARDA_NO_SHELL
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+void resetTestCounters() {
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+static int ptStep = 0;
+static int ptLoops = 0;
+static bool ptReady = false;
+
+TASK_LOOP(pt) {
+    ptLoops++;
+    ARDA_TASK_BEGIN();
+    ptStep = 1;
+    ARDA_SLEEP(100);
+    ptStep = 2;
+    ARDA_AWAIT(ptReady);
+    ptStep = 3;
+    ARDA_AWAIT_NOTIFY();
+    OS.takeNotification();
+    ptStep = 4;
+    ARDA_TASK_END();
+}
+
+void test_protothread_sleep() {
+    printf("Test: ARDA_SLEEP parks the task in the deadline heap... ");
+    resetTestCounters();
+    ptStep = 0;
+    ptLoops = 0;
+    ptReady = false;
+
+    int8_t id = OS.createTask("pt", nullptr, pt_loop, 0);
+    OS.begin();
+
+    OS.run();
+    assert(ptStep == 1);
+    assert(OS.getTaskInterval(id) == 0);     // Own interval, not the sleep time
+    assert(OS.msUntilNextDue() == 100);
+
+    for (int i = 0; i < 10; i++) {
+        advanceMockMillis(9);
+        OS.run();
+    }
+    assert(ptLoops == 1);                    // Never dispatched while asleep
+
+    advanceMockMillis(10);                   // t=100
+    OS.run();
+    assert(ptStep == 2);
+    assert(OS.getTaskInterval(id) == 0);     // Own interval back
+
+    printf("PASSED\n");
+}
+
+void test_protothread_await_and_notify() {
+    printf("Test: ARDA_AWAIT polls, ARDA_AWAIT_NOTIFY waits for notifyTask... ");
+    resetTestCounters();
+    ptStep = 0;
+    ptLoops = 0;
+    ptReady = false;
+
+    int8_t id = OS.createTask("pt", nullptr, pt_loop, 0);
+    OS.begin();
+    OS.run();
+    setMockMillis(100);
+    OS.run();
+    assert(ptStep == 2);
+
+    int before = ptLoops;
+    OS.run();
+    OS.run();
+    assert(ptLoops == before + 2);           // Condition polled every cycle (interval 0)
+    assert(ptStep == 2);
+
+    ptReady = true;
+    OS.run();
+    assert(ptStep == 3);
+    assert(OS.isTaskEventMode(id));          // Waiting for a notification
+
+    before = ptLoops;
+    for (int i = 0; i < 5; i++) OS.run();
+    assert(ptLoops == before);               // Not polled while waiting
+
+    assert(OS.notifyTask(id, 0x01));
+    OS.run();
+    assert(ptStep == 4);
+    assert(!OS.isTaskEventMode(id));         // Event mode was borrowed only
+
+    OS.run();
+    assert(ptStep == 1);                     // ARDA_TASK_END: back to the top
+
+    printf("PASSED\n");
+}
+
+void test_protothread_stop_rewinds() {
+    printf("Test: stopTask rewinds a protothread... ");
+    resetTestCounters();
+    ptStep = 0;
+    ptReady = false;
+
+    int8_t id = OS.createTask("pt", nullptr, pt_loop, 20);
+    OS.begin();
+    setMockMillis(20);
+    OS.run();
+    assert(ptStep == 1);
+    assert(OS.getTaskInterval(id) == 20);
+
+    OS.stopTask(id);
+    assert(OS.getTaskInterval(id) == 20);    // Sleep undone
+    ptStep = 0;
+    OS.startTask(id);
+    setMockMillis(40);
+    OS.run();
+    assert(ptStep == 1);                     // Ran from the top, not after the sleep
+
+    // Outside a task the macros' hooks are inert
+    assert(OS.taskResumePoint() == 0);
+    OS.sleepCurrentTask(10);
+    OS.waitCurrentTaskNotify();
+
+    printf("PASSED\n");
+}
+
+void test_protothread_set_interval_while_asleep() {
+    printf("Test: setTaskInterval mid-sleep survives the wake... ");
+    resetTestCounters();
+    ptStep = 0;
+    ptLoops = 0;
+    ptReady = false;
+
+    int8_t id = OS.createTask("pt", nullptr, pt_loop, 0);
+    OS.begin();
+    OS.run();
+    assert(ptStep == 1);                     // Asleep until t=100
+
+    setMockMillis(50);
+    assert(OS.setTaskInterval(id, 30));
+    assert(OS.getTaskInterval(id) == 30);
+    OS.run();
+    assert(ptLoops == 1);                    // Pending sleep left alone
+    assert(OS.msUntilNextDue() == 50);
+
+    setMockMillis(100);
+    OS.run();
+    assert(ptStep == 2);
+    assert(OS.getTaskInterval(id) == 30);    // New interval kept after the wake
+
+    setMockMillis(120);
+    OS.run();
+    assert(ptLoops == 2);                    // Not due again until t=130
+    setMockMillis(130);
+    OS.run();
+    assert(ptLoops == 3);
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== ARDA_PROTOTHREADS Tests ===\n\n");
+
+    test_protothread_sleep();
+    test_protothread_await_and_notify();
+    test_protothread_stop_rewinds();
+    test_protothread_set_interval_while_asleep();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
@@ -507,6 +507,42 @@ void test_shell_when_command() {
     printf("PASSED\n");
 }
 
+void test_shell_micros_task_units() {
+    printf("Test: shell reports microsecond task units... ");
+    resetTestCounters();
+
+    MockStream mockStream;
+    OS.setShellStream(mockStream);
+
+    OS.createTaskMicros("fast", task1_setup, task1_loop, 2500);
+    OS.begin();
+
+    mockStream.setInput("i 1\n");
+    mockStream.clearOutput();
+    OS.run();
+    assert(strstr(mockStream.getOutput(), "int:2500us") != nullptr);
+
+    advanceMockMillis(3);  // 3000us >= 2500us interval
+    OS.run();
+    assert(OS.getTaskRunCount(1) == 1);
+
+    advanceMockMillis(1);
+    mockStream.setInput("w 1\n");
+    mockStream.clearOutput();
+    OS.run();
+    assert(strstr(mockStream.getOutput(), "1000us ago") != nullptr);
+    assert(strstr(mockStream.getOutput(), "next:1500us") != nullptr);
+
+    // 'a' keeps the task's unit
+    mockStream.setInput("a 1 4000\n");
+    mockStream.clearOutput();
+    OS.run();
+    assert(OS.isTaskMicros(1));
+    assert(OS.getTaskInterval(1) == 4000);
+
+    printf("PASSED\n");
+}
+
 void test_shell_go_command() {
     printf("Test: shell go command... ");
     resetTestCounters();
@@ -1571,6 +1607,7 @@ int main() {
     test_shell_kill_command();
     test_shell_kill_stopped_task();
     test_shell_when_command();
+    test_shell_micros_task_units();
     test_shell_go_command();
     test_shell_clear_command();
     test_shell_adjust_command();
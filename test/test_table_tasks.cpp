@@ -0,0 +1,166 @@
+// Test for table-backed tasks (ARDA_TABLE_TASKS)
+// Build: g++ -std=c++11 -I. -o test_table_tasks test_table_tasks.cpp && ./test_table_tasks
+//
+// This verifies that:
+// 1. createTasks() points each slot at its table row: names are not copied and
+//    setup/loop/teardown are called through the row
+// 2. Interval and priority start from the row and stay mutable per task
+// 3. Table errors (duplicates, bad interval) are reported per row, renameTask() is
+//    NotSupported, and a deleted task's slot can be filled from a table again
+// 4. The shell task and 'l' listing work without a name or callbacks in RAM
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable table-backed tasks BEFORE including Arda (keeps the shell for the listing test)
+#define ARDA_TABLE_TASKS
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+static int setups = 0;
+static int sensorRuns = 0;
+static int ledRuns = 0;
+static int teardowns = 0;
+void countSetup() { setups++; }
+void sensorLoop() { sensorRuns++; }
+void ledLoop() { ledRuns++; }
+void countTeardown() { teardowns++; }
+
+ARDA_STATIC_TASKS(appTasks,
+    ARDA_TASK_DEF_FULL("sensor", countSetup, sensorLoop, 0, countTeardown, TaskPriority::High),
+    ARDA_TASK_DEF("led", nullptr, ledLoop, 10)
+);
+
+ARDA_STATIC_TASKS(badTasks,
+    ARDA_TASK_DEF("led", nullptr, ledLoop, 0),                 // Duplicate of appTasks[1]
+    ARDA_TASK_DEF("slow", nullptr, ledLoop, 0x80000000UL),     // Above ARDA_MAX_INTERVAL
+    ARDA_TASK_DEF("spare", nullptr, sensorLoop, 0)
+);
+
+void resetTestCounters() {
+    setups = 0;
+    sensorRuns = 0;
+    ledRuns = 0;
+    teardowns = 0;
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+void test_slots_point_at_rows() {
+    printf("Test: table tasks read name and callbacks from their row... ");
+    resetTestCounters();
+
+    assert(OS.createTasks(appTasks) == 2);
+    int8_t sensor = OS.findTaskByName("sensor");
+    int8_t led = OS.findTaskByName("led");
+    assert(sensor >= 0 && led >= 0);
+    assert(OS.getTaskName(sensor) == appTasks[0].name);  // The row's own string, not a copy
+    assert(OS.hasTaskSetup(sensor) && OS.hasTaskTeardown(sensor));
+    assert(!OS.hasTaskSetup(led));
+
+    OS.begin();
+    assert(setups == 1);
+    OS.run();
+    assert(sensorRuns == 1 && ledRuns == 0);  // led not due until t=10
+    setMockMillis(10);
+    OS.run();
+    assert(sensorRuns == 2 && ledRuns == 1);
+
+    assert(OS.stopTask(sensor) == StopResult::Success);
+    assert(teardowns == 1);
+
+    printf("PASSED\n");
+}
+
+void test_mutable_fields_start_from_row() {
+    printf("Test: interval and priority start from the row and stay mutable... ");
+    resetTestCounters();
+
+    OS.createTasks(appTasks);
+    int8_t sensor = OS.findTaskByName("sensor");
+    int8_t led = OS.findTaskByName("led");
+    assert(OS.getTaskInterval(led) == 10);
+    assert(OS.getTaskPriority(sensor) == TaskPriority::High);
+    assert(OS.getTaskPriority(led) == TaskPriority::Normal);
+
+    assert(OS.setTaskInterval(led, 50));
+    assert(OS.setTaskPriority(sensor, TaskPriority::Low));
+    assert(OS.getTaskInterval(led) == 50);
+    assert(OS.getTaskPriority(sensor) == TaskPriority::Low);
+    assert(appTasks[1].interval == 10);  // The row itself is untouched
+
+    printf("PASSED\n");
+}
+
+void test_table_errors_and_reuse() {
+    printf("Test: row errors, renameTask and slot reuse... ");
+    resetTestCounters();
+
+    assert(OS.createTasks(appTasks) == 2);
+    int8_t failed = 0;
+    assert(OS.createTasks(badTasks, &failed) == 1);  // Only "spare" is created
+    assert(failed == 0);
+    assert(OS.getError() == ArdaError::DuplicateName);
+    assert(OS.findTaskByName("slow") == -1);
+
+    int8_t led = OS.findTaskByName("led");
+    assert(!OS.renameTask(led, "blink"));
+    assert(OS.getError() == ArdaError::NotSupported);
+
+    // A deleted slot has no row; the next table task takes it over
+    assert(OS.deleteTask(led));
+    assert(OS.getTaskName(led) == nullptr);
+    assert(!OS.hasTaskLoop(led));
+    assert(OS.createTasks(badTasks, 1) == 1);
+    assert(OS.findTaskByName("led") == led);
+    assert(OS.getTaskName(led) == badTasks[0].name);
+
+    printf("PASSED\n");
+}
+
+void test_shell_lists_table_tasks() {
+    printf("Test: shell task and 'l' listing with table tasks... ");
+    resetTestCounters();
+
+    MockStream mockStream;
+    OS.setShellStream(mockStream);
+    OS.createTasks(appTasks);
+    OS.begin();
+
+    mockStream.setInput("l\n");
+    mockStream.clearOutput();
+    OS.run();
+
+    const char* output = mockStream.getOutput();
+    assert(strstr(output, "0 R sh") != nullptr);
+    assert(strstr(output, "1 R sensor") != nullptr);
+    assert(strstr(output, "2 R led") != nullptr);
+    assert(OS.findTaskByName("sh") == ARDA_SHELL_TASK_ID);
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== Table Task Tests ===\n\n");
+
+    test_slots_point_at_rows();
+    test_mutable_fields_start_from_row();
+    test_table_errors_and_reuse();
+    test_shell_lists_table_tasks();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
@@ -0,0 +1,128 @@
+// Test for context-pointer callbacks (ARDA_TASK_CONTEXT)
+// Build: g++ -std=c++11 -I. -o test_task_context test_task_context.cpp && ./test_task_context
+//
+// This verifies that:
+// 1. One set of TaskContextCallback functions can drive several task instances
+// 2. setup/loop/teardown all receive the task's own context pointer
+// 3. Plain void(void) tasks keep working alongside context tasks
+// 4. getTaskContext() and slot reuse behave as documented
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable context callbacks and disable shell BEFORE including Arda
+#define ARDA_TASK_CONTEXT
+#define ARDA_NO_SHELL
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+// A "driver" instantiated once per sensor
+struct Sensor {
+    int pin;
+    int setups;
+    int reads;
+    int teardowns;
+};
+
+void sensorSetup(void* ctx) { static_cast<Sensor*>(ctx)->setups++; }
+void sensorLoop(void* ctx) { static_cast<Sensor*>(ctx)->reads++; }
+void sensorTeardown(void* ctx) { static_cast<Sensor*>(ctx)->teardowns++; }
+
+static int plainRuns = 0;
+void plainLoop() { plainRuns++; }
+
+void resetTestCounters() {
+    plainRuns = 0;
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+void test_shared_callbacks() {
+    printf("Test: one driver, several instances... ");
+    resetTestCounters();
+
+    Sensor sensors[3] = {{2, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}};
+    const char* names[3] = {"s2", "s3", "s4"};
+    int8_t ids[3];
+    for (int k = 0; k < 3; k++) {
+        ids[k] = OS.createTask(names[k], sensorSetup, sensorLoop, &sensors[k],
+                               (uint32_t)(10 * (k + 1)), sensorTeardown);
+        assert(ids[k] >= 0);
+        assert(OS.getTaskContext(ids[k]) == &sensors[k]);
+    }
+    int8_t plain = OS.createTask("plain", nullptr, plainLoop, 0);
+    assert(plain >= 0);
+    assert(OS.getTaskContext(plain) == nullptr);
+
+    OS.begin();
+    for (int k = 0; k < 3; k++) assert(sensors[k].setups == 1);
+
+    for (int t = 0; t <= 60; t++) {
+        setMockMillis(t);
+        OS.run();
+    }
+    // Each instance ran on its own interval with its own state
+    assert(sensors[0].reads == 6);  // 10,20,...,60
+    assert(sensors[1].reads == 3);  // 20,40,60
+    assert(sensors[2].reads == 2);  // 30,60
+    assert(plainRuns == 61);
+
+    assert(OS.stopTask(ids[1]) == StopResult::Success);
+    assert(sensors[1].teardowns == 1);
+    assert(sensors[0].teardowns == 0 && sensors[2].teardowns == 0);
+
+    printf("PASSED\n");
+}
+
+void test_context_after_begin_and_reuse() {
+    printf("Test: context setup after begin(), slot reuse... ");
+    resetTestCounters();
+    OS.begin();
+
+    Sensor s = {5, 0, 0, 0};
+    int8_t id = OS.createTask("late", sensorSetup, sensorLoop, &s, 0);
+    assert(id >= 0);
+    assert(s.setups == 1);  // Auto-started with the context already in place
+    OS.run();
+    assert(s.reads == 1);
+
+    assert(OS.killTask(id));
+    assert(OS.getTaskContext(id) == nullptr);
+
+    // A plain task reusing the slot must not be called with a context
+    int8_t reused = OS.createTask("plain", nullptr, plainLoop, 0);
+    assert(reused == id);
+    OS.run();
+    assert(plainRuns == 1);
+    assert(s.reads == 1);
+
+    // Errors match createTask()
+    assert(OS.createTask("plain", sensorSetup, sensorLoop, &s) == -1);
+    assert(OS.getError() == ArdaError::DuplicateName);
+    assert(OS.getTaskContext(-1) == nullptr);
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== Task Context Tests ===\n\n");
+
+    test_shared_callbacks();
+    test_context_after_begin_and_reuse();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}
@@ -0,0 +1,153 @@
+// Test for software timers (ARDA_MAX_TIMERS > 0)
+// Build: g++ -std=c++11 -I. -o test_timers test_timers.cpp && ./test_timers
+//
+// This verifies that:
+// 1. setTimeout() fires once, setInterval() repeats on a fixed grid
+// 2. Timers fire earliest first and don't use task slots
+// 3. cancelTimer() works (also from the timer's own callback) and handles go stale
+// 4. The pool limit, argument checks and reset() behave as documented
+// 5. msUntilNextDue() accounts for pending timers
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <new>
+
+// Mock Arduino environment
+#include "Arduino.h"
+uint32_t _mockMillis = 0;
+MockSerial Serial;
+
+// Enable a small timer pool and disable shell BEFORE including Arda
+#define ARDA_MAX_TIMERS 4
+#define ARDA_NO_SHELL
+#include "../Arda.h"
+#include "../Arda.cpp"
+
+// Reset global OS instance to clean state between tests.
+void resetGlobalOS() {
+    OS.~Arda();
+    new (&OS) Arda();
+}
+
+static char fired[16];
+static uint8_t firedLen = 0;
+static TimerHandle selfCancelHandle = 0;
+
+void resetTestCounters() {
+    memset(fired, 0, sizeof(fired));
+    firedLen = 0;
+    setMockMillis(0);
+    resetGlobalOS();
+}
+
+static void record(char c) { if (firedLen < sizeof(fired) - 1) fired[firedLen++] = c; }
+void timerA() { record('a'); }
+void timerB() { record('b'); }
+void timerSelfCancel() {
+    record('s');
+    OS.cancelTimer(selfCancelHandle);
+}
+void timerRearm() {
+    record('r');
+    OS.setTimeout(timerRearm, 0);  // Re-arms forever; must not starve run()
+}
+
+void test_timeout_and_interval() {
+    printf("Test: setTimeout fires once, setInterval repeats... ");
+    resetTestCounters();
+
+    TimerHandle once = OS.setTimeout(timerA, 30);
+    TimerHandle every = OS.setInterval(timerB, 20);
+    assert(once != 0 && every != 0 && once != every);
+    assert(OS.getTaskCount() == 0);  // No task slots used
+    OS.begin();
+    assert(OS.msUntilNextDue() == 20);
+
+    for (int t = 1; t <= 60; t++) {
+        setMockMillis(t);
+        OS.run();
+    }
+    assert(strcmp(fired, "babb") == 0);  // b@20, a@30, b@40, b@60
+    assert(!OS.isTimerActive(once));
+    assert(OS.isTimerActive(every));
+
+    // Late polling skips missed periods instead of bursting
+    setMockMillis(175);
+    firedLen = 0;
+    memset(fired, 0, sizeof(fired));
+    OS.run();
+    OS.run();
+    assert(strcmp(fired, "b") == 0);
+    assert(OS.msUntilNextDue() == 20);
+
+    printf("PASSED\n");
+}
+
+void test_cancel_timer() {
+    printf("Test: cancelTimer and stale handles... ");
+    resetTestCounters();
+    OS.begin();
+
+    TimerHandle h = OS.setTimeout(timerA, 10);
+    assert(OS.cancelTimer(h));
+    assert(!OS.cancelTimer(h));
+    assert(OS.getError() == ArdaError::InvalidId);
+    assert(!OS.cancelTimer(0));
+
+    // Reusing the slot gives a different handle
+    TimerHandle h2 = OS.setTimeout(timerA, 10);
+    assert(h2 != h);
+    assert(!OS.isTimerActive(h));
+
+    selfCancelHandle = OS.setInterval(timerSelfCancel, 5);
+    setMockMillis(10);
+    OS.run();
+    setMockMillis(20);
+    OS.run();
+    assert(strcmp(fired, "sa") == 0);  // s due at 5, a at 10; s cancelled itself
+    assert(!OS.isTimerActive(selfCancelHandle));
+
+    printf("PASSED\n");
+}
+
+void test_timer_limits() {
+    printf("Test: timer pool limit, validation and reset... ");
+    resetTestCounters();
+
+    assert(OS.setTimeout(nullptr, 10) == 0);
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(OS.setInterval(timerA, 0) == 0);
+    assert(OS.getError() == ArdaError::InvalidValue);
+    assert(OS.setTimeout(timerA, ARDA_MAX_INTERVAL + 1) == 0);
+
+    TimerHandle hs[ARDA_MAX_TIMERS];
+    for (int k = 0; k < ARDA_MAX_TIMERS; k++) {
+        hs[k] = OS.setTimeout(timerA, 10);
+        assert(hs[k] != 0);
+    }
+    assert(OS.setTimeout(timerA, 10) == 0);
+    assert(OS.getError() == ArdaError::NoTimers);
+
+    OS.reset();
+    for (int k = 0; k < ARDA_MAX_TIMERS; k++) assert(!OS.isTimerActive(hs[k]));
+
+    // A timer that re-arms itself with 0 delay is bounded per run()
+    OS.begin();
+    OS.setTimeout(timerRearm, 0);
+    OS.run();
+    assert(firedLen == ARDA_MAX_TIMERS);
+
+    printf("PASSED\n");
+}
+
+int main() {
+    printf("\n=== Software Timer Tests ===\n\n");
+
+    test_timeout_and_interval();
+    test_cancel_timer();
+    test_timer_limits();
+
+    printf("\n=== All tests passed! ===\n\n");
+    return 0;
+}